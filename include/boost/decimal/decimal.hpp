@@ -9,6 +9,11 @@
 #define BOOST_DECIMAL_HPP
 
 #include "decimal32.hpp"
+#include "fixed_decimal.hpp"
+#include "literals.hpp"
+#include "filter.hpp"
+#include "quantize.hpp"
+#include "quantile_sketch.hpp"
 #include "detail/type_traits.hpp"
 #include "detail/concepts.hpp"
 #include "detail/math.hpp"
@@ -22,6 +22,8 @@
 #include <string>
 #include <compare>
 #include "tools/config.hpp"
+#include "detail/power_tables.hpp"
+#include "detail/rounding.hpp"
 
 #define BOOST_DECIMAL32_BITS            32
 #define BOOST_DECIMAL32_BYTES           4
@@ -40,6 +42,16 @@
 
 namespace boost::decimal {
 
+class decimal32;
+
+namespace detail {
+
+/// Rounds significand * 10^exp10 half to even to the nearest decimal32.
+/// Overflow gives signed infinity and underflow gives zero
+[[nodiscard]] constexpr decimal32 make_decimal32(bool sign, std::uint64_t significand, int exp10) noexcept;
+
+} // Namespace detail
+
 /// 3.2.2 Decimal32
 class decimal32 final
 {
@@ -53,6 +65,8 @@ private:
 
     bit_layout_ data_;
 
+    friend constexpr decimal32 detail::make_decimal32(bool sign, std::uint64_t significand, int exp10) noexcept;
+
     constexpr void normalize() noexcept;
     
     template <std::floating_point T>
@@ -71,6 +85,9 @@ public:
     ~decimal32() = default;
 
     /// 3.2.5  Initialization from coefficient and exponent.
+    /// The leading digit of coeff is placed at 10^expon e.g. decimal32 {1234, 1} is 12.34.
+    /// With more than seven digits the value is coeff * 10^(expon - 6) rounded half to even,
+    /// e.g. decimal32 {12345675, 0} is 12.34568. Values below the range become zero
     constexpr decimal32(std::integral auto coeff, int expon);
 
     /// Non-standard construct from sign, mantissa, exponent
@@ -98,27 +115,30 @@ public:
     [[nodiscard]] inline auto to_string() const;
 
     // 3.2.7 Unary arithmetic operators
-    [[nodiscard]] constexpr decimal32 operator+() noexcept;
-    [[nodiscard]] constexpr decimal32 operator-() noexcept;
+    [[nodiscard]] constexpr decimal32 operator+() const noexcept;
+    [[nodiscard]] constexpr decimal32 operator-() const noexcept;
 
     // 3.2.8 Binary arithmetic operators
     [[nodiscard]] constexpr decimal32 operator*(decimal32 rhs) const noexcept;
     constexpr void operator*=(decimal32 rhs) noexcept;
 
     // 3.2.9 Comparison operators
-    [[nodiscard]] constexpr bool operator==(decimal32 rhs) noexcept;
+    [[nodiscard]] constexpr bool operator==(decimal32 rhs) const noexcept;
 
     template <std::integral T>
-    [[nodiscard]] constexpr bool operator==(T rhs) noexcept;
+    [[nodiscard]] constexpr bool operator==(T rhs) const noexcept;
 
-    [[nodiscard]] constexpr bool operator!=(decimal32 rhs) noexcept;
+    [[nodiscard]] constexpr bool operator!=(decimal32 rhs) const noexcept;
 
     template <std::integral T>
-    [[nodiscard]] constexpr bool operator!=(T rhs) noexcept;
+    [[nodiscard]] constexpr bool operator!=(T rhs) const noexcept;
 
-    [[nodiscard]] constexpr decimal32 operator!() noexcept;
+    [[nodiscard]] constexpr decimal32 operator!() const noexcept;
 
+    [[nodiscard]] constexpr bool operator<(decimal32 rhs) const noexcept;
+    [[nodiscard]] constexpr bool operator<=(decimal32 rhs) const noexcept;
     [[nodiscard]] constexpr bool operator>(decimal32 rhs) const noexcept;
+    [[nodiscard]] constexpr bool operator>=(decimal32 rhs) const noexcept;
 
     /// Getters to allow access to the bit layout
     [[nodiscard]] constexpr auto mantissa() const noexcept { return data_.mantissa; }
@@ -130,45 +150,62 @@ public:
     constexpr unsigned size() const { return sizeof(data_); }
 };
 
-constexpr void decimal32::normalize() noexcept
+namespace detail {
+
+/// Quiet or signaling NaN. boost::decimal::isnan forwards here so the comparison operators can share it
+[[nodiscard]] constexpr bool is_nan_layout(decimal32 x) noexcept
 {
-    while (this->mantissa() < BOOST_DECIMAL32_MAN_MIN)
-    {
-        this->data_.mantissa *= 10;
-    }
+    return x.mantissa() == BOOST_DECIMAL32_QUIET_NAN || x.mantissa() == BOOST_DECIMAL32_SIGNALING_NAN;
 }
 
-constexpr decimal32::decimal32(std::integral auto coeff, int expon)
+/// Integer whose ordering matches the value ordering of every non-NaN decimal32.
+/// The mantissa is normalized so magnitude orders by (exponent, mantissa), with zero below
+/// everything and infinity above everything, and the sign then simply negates the key.
+[[nodiscard]] constexpr std::int32_t ordering_key(decimal32 x) noexcept
 {
-    this->data_.sign = coeff < 0 ? true : false;
-    if (data_.sign)
-    {
-        coeff = -coeff;
-    }
+    std::int32_t magnitude {};
 
-    while (coeff > BOOST_DECIMAL32_MAN_MAX)
+    if (x.mantissa() > BOOST_DECIMAL32_MAN_MAX)
     {
-        coeff /= 10;
-        ++expon;
+        magnitude = INT32_MAX;
     }
-
-    if (expon > BOOST_DECIMAL32_EMAX)
+    else if (x.mantissa() != 0)
     {
-        this->data_.mantissa = BOOST_DECIMAL32_INF;
-        this->data_.expon = BOOST_DECIMAL32_EMAX;
+        // Biasing the exponent by 64 maps [EMIN, EMAX] onto [1, 127]
+        magnitude = static_cast<std::int32_t>((static_cast<std::uint32_t>(x.exponent() + 64) << BOOST_DECIMAL32_MAN_BITS) | x.mantissa());
     }
-    else if (expon < BOOST_DECIMAL32_EMIN)
+
+    return x.sign() ? -magnitude : magnitude;
+}
+
+} // Namespace detail
+
+constexpr void decimal32::normalize() noexcept
+{
+    // Zero has no leading digit to shift into place
+    if (this->mantissa() == 0)
     {
-        this->data_.mantissa = BOOST_DECIMAL32_INF;
-        this->data_.expon = BOOST_DECIMAL32_EMIN;
+        return;
     }
-    else
+
+    while (this->mantissa() < BOOST_DECIMAL32_MAN_MIN)
     {
-        this->data_.mantissa = coeff;
-        this->data_.expon = expon;
+        this->data_.mantissa *= 10;
     }
+}
 
-    this->normalize();
+constexpr decimal32::decimal32(std::integral auto coeff, int expon)
+{
+    const bool sign {coeff < 0};
+
+    // Negate in the unsigned domain so that the minimum value of a signed type does not overflow
+    const std::uint64_t mag {sign ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(coeff) :
+                                    static_cast<std::uint64_t>(coeff)};
+
+    // The first seven digits are placed from 10^expon downwards. Digits beyond those are rounded
+    // half to even through make_decimal32, as for literals and arithmetic
+    const int digits {detail::num_digits(mag)};
+    *this = detail::make_decimal32(sign, mag, expon + 1 - (digits < BOOST_DECIMAL32_PRECISION ? digits : BOOST_DECIMAL32_PRECISION));
 }
 
 constexpr decimal32::decimal32(bool sign, std::integral auto mantissa, std::integral auto exponent) noexcept
@@ -183,7 +220,8 @@ constexpr decimal32::decimal32(bool sign, std::integral auto mantissa, std::inte
 template <std::floating_point T>
 [[nodiscard]] constexpr T decimal32::to_floating_point_type() const
 {
-    T temp {static_cast<T>(this->mantissa() * std::pow(static_cast<T>(10.), this->exponent() - BOOST_DECIMAL32_PRECISION + 1))};
+    // Rounded once to double, whose range and precision cover every decimal32, then to T
+    T temp {static_cast<T>(detail::significand_to_double(this->mantissa(), this->exponent() - BOOST_DECIMAL32_PRECISION + 1))};
 
     // decimal32 can only be larger than floats
     if constexpr (std::is_same_v<T, float>)
@@ -291,22 +329,27 @@ template <typename T>
     }
 }
 
-[[nodiscard]] constexpr decimal32 decimal32::operator+() noexcept
+[[nodiscard]] constexpr decimal32 decimal32::operator+() const noexcept
 {
     return *this;
 }
 
-[[nodiscard]] constexpr decimal32 decimal32::operator-() noexcept
+[[nodiscard]] constexpr decimal32 decimal32::operator-() const noexcept
 {
-    this->data_.sign = !this->data_.sign;
-    return *this;
+    auto temp = *this;
+    temp.data_.sign = !temp.data_.sign;
+
+    return temp;
 }
 
 [[nodiscard]] constexpr decimal32 decimal32::operator*(decimal32 rhs) const noexcept
 {
-    return decimal32 {static_cast<bool>(this->sign() * rhs.sign()),
-                      this->mantissa() * rhs.mantissa(),
-                      this->exponent() + rhs.exponent()};
+    // Each operand is mantissa * 10^(exponent - precision + 1), so the exact product of the
+    // mantissas is scaled by 10^(exponent sum - 2 * (precision - 1)) and then rounded to precision
+    const auto product {static_cast<std::uint64_t>(this->mantissa()) * static_cast<std::uint64_t>(rhs.mantissa())};
+
+    return detail::make_decimal32(this->sign() != rhs.sign(), product,
+                                  this->exponent() + rhs.exponent() - 2 * (BOOST_DECIMAL32_PRECISION - 1));
 }
 
 constexpr void decimal32::operator*=(decimal32 rhs) noexcept
@@ -314,20 +357,19 @@ constexpr void decimal32::operator*=(decimal32 rhs) noexcept
     *this = *this * rhs;
 }
 
-[[nodiscard]] constexpr bool decimal32::operator==(decimal32 rhs) noexcept
+[[nodiscard]] constexpr bool decimal32::operator==(decimal32 rhs) const noexcept
 {
-    if (this->sign() == rhs.sign() &&
-        this->exponent() == rhs.exponent() &&
-        this->mantissa() == rhs.mantissa())
+    // NaN compares unequal to everything, and positive and negative zero are equal
+    if (detail::is_nan_layout(*this) || detail::is_nan_layout(rhs))
     {
-        return true;
+        return false;
     }
 
-    return false;
+    return detail::ordering_key(*this) == detail::ordering_key(rhs);
 }
 
 template <std::integral T>
-[[nodiscard]] constexpr bool decimal32::operator==(T rhs) noexcept
+[[nodiscard]] constexpr bool decimal32::operator==(T rhs) const noexcept
 {
     if (this->to<T>() == rhs)
     {
@@ -337,18 +379,18 @@ template <std::integral T>
     return false;
 }
 
-[[nodiscard]] constexpr bool decimal32::operator!=(decimal32 rhs) noexcept
+[[nodiscard]] constexpr bool decimal32::operator!=(decimal32 rhs) const noexcept
 {
     return !(*this == rhs);
 }
 
 template <std::integral T>
-[[nodiscard]] constexpr bool decimal32::operator!=(T rhs) noexcept
+[[nodiscard]] constexpr bool decimal32::operator!=(T rhs) const noexcept
 {
     return !(*this == rhs);
 }
 
-[[nodiscard]] constexpr decimal32 decimal32::operator!() noexcept
+[[nodiscard]] constexpr decimal32 decimal32::operator!() const noexcept
 {
     auto temp = *this;
     temp.data_.sign = !temp.data_.sign;
@@ -356,29 +398,91 @@ template <std::integral T>
     return temp;
 }
 
-[[nodiscard]] constexpr bool decimal32::operator>(decimal32 rhs) const noexcept
+[[nodiscard]] constexpr bool decimal32::operator<(decimal32 rhs) const noexcept
 {
-    if (rhs.exponent() < this->exponent())
+    if (detail::is_nan_layout(*this) || detail::is_nan_layout(rhs))
     {
-        return true;
+        return false;
     }
-    else if (rhs.exponent() > this->exponent())
+
+    return detail::ordering_key(*this) < detail::ordering_key(rhs);
+}
+
+[[nodiscard]] constexpr bool decimal32::operator<=(decimal32 rhs) const noexcept
+{
+    if (detail::is_nan_layout(*this) || detail::is_nan_layout(rhs))
     {
         return false;
     }
-    
-    if(rhs.mantissa() < this->mantissa())
+
+    return detail::ordering_key(*this) <= detail::ordering_key(rhs);
+}
+
+[[nodiscard]] constexpr bool decimal32::operator>(decimal32 rhs) const noexcept
+{
+    return rhs < *this;
+}
+
+[[nodiscard]] constexpr bool decimal32::operator>=(decimal32 rhs) const noexcept
+{
+    return rhs <= *this;
+}
+
+namespace detail {
+
+[[nodiscard]] constexpr decimal32 make_decimal32(bool sign, std::uint64_t significand, int exp10) noexcept
+{
+    if (significand == 0)
     {
-        return true;
+        return decimal32 {};
+    }
+
+    const int digits {num_digits(significand)};
+
+    if (digits > BOOST_DECIMAL32_PRECISION)
+    {
+        significand = div_round_half_even(significand, pow10(digits - BOOST_DECIMAL32_PRECISION));
+        exp10 += digits - BOOST_DECIMAL32_PRECISION;
+
+        // Rounding carried into a new digit e.g. 99999995 -> 10000000
+        if (significand > BOOST_DECIMAL32_MAN_MAX)
+        {
+            significand /= 10;
+            ++exp10;
+        }
     }
-    else if (rhs.mantissa() > this->mantissa())
+    else
     {
-        return false;
+        significand *= pow10(BOOST_DECIMAL32_PRECISION - digits);
+        exp10 -= BOOST_DECIMAL32_PRECISION - digits;
     }
 
-    return false;
+    // The stored exponent is that of the leading digit
+    const int expon {exp10 + BOOST_DECIMAL32_PRECISION - 1};
+
+    decimal32 result {};
+    result.data_.sign = sign;
+
+    if (expon > BOOST_DECIMAL32_EMAX)
+    {
+        result.data_.mantissa = BOOST_DECIMAL32_INF;
+        result.data_.expon = BOOST_DECIMAL32_EMAX;
+    }
+    else if (expon >= BOOST_DECIMAL32_EMIN)
+    {
+        result.data_.mantissa = static_cast<std::uint32_t>(significand);
+        result.data_.expon = expon;
+    }
+    else
+    {
+        result.data_.sign = 0;
+    }
+
+    return result;
 }
 
+} // Namespace detail
+
 /// Type alias to match STL
 using decimal32_t = decimal32;
 
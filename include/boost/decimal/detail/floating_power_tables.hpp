@@ -0,0 +1,164 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Powers of ten as unevaluated sums high + low of two doubles, where high is 10^n
+//  correctly rounded and low is the correctly rounded remainder 10^n - high.
+
+#ifndef BOOST_DECIMAL_DETAIL_FLOATING_POWER_TABLES_HPP
+#define BOOST_DECIMAL_DETAIL_FLOATING_POWER_TABLES_HPP
+
+namespace boost::decimal::detail::floating_power_tables {
+
+struct double_double
+{
+    double high;
+    double low;
+};
+
+/// Smallest power in the table, which covers the scale of every decimal32
+inline constexpr int min_exponent {-70};
+inline constexpr int max_exponent {63};
+
+/// 10^n for n in [min_exponent, max_exponent], indexed by n - min_exponent
+inline constexpr double_double powers_of_10[max_exponent - min_exponent + 1] = {
+    {1e-70, 4.3339665037706365e-88}, // 10^-70
+    {1e-69, 3.650620143794582e-86}, // 10^-69
+    {1e-68, -6.644495035141476e-85}, // 10^-68
+    {1e-67, 5.709643179581793e-84}, // 10^-67
+    {1e-66, 2.415206322322255e-83}, // 10^-66
+    {1e-65, 7.686305293937516e-82}, // 10^-65
+    {1e-64, 3.469426116645307e-81}, // 10^-64
+    {1e-63, -6.651083908855995e-80}, // 10^-63
+    {1e-62, -3.9522812353889814e-79}, // 10^-62
+    {1e-61, -3.9522812353889814e-78}, // 10^-61
+    {1e-60, 2.9566536086865743e-77}, // 10^-60
+    {1e-59, -2.57049426657387e-76}, // 10^-59
+    {1e-58, -2.57049426657387e-75}, // 10^-58
+    {1e-57, 4.504255013759499e-74}, // 10^-57
+    {1e-56, -3.9854441226405437e-73}, // 10^-56
+    {1e-55, 5.423954167728123e-73}, // 10^-55
+    {1e-54, -3.079876214757873e-71}, // 10^-54
+    {1e-53, -3.0798762147578723e-70}, // 10^-53
+    {1e-52, -7.616223705782342e-70}, // 10^-52
+    {1e-51, -7.616223705782343e-69}, // 10^-51
+    {1e-50, -7.616223705782342e-68}, // 10^-50
+    {1e-49, 6.360053438741615e-66}, // 10^-49
+    {1e-48, 2.5618263404376953e-65}, // 10^-48
+    {1e-47, 2.5618263404376953e-64}, // 10^-47
+    {1e-46, -2.2999043453913218e-63}, // 10^-46
+    {1e-45, 1.589480203271892e-62}, // 10^-45
+    {1e-44, 4.700987842202463e-61}, // 10^-44
+    {1e-43, -7.745042713519821e-60}, // 10^-43
+    {1e-42, -3.76231293568869e-59}, // 10^-42
+    {1e-41, -5.761291134237854e-59}, // 10^-41
+    {1e-40, 7.070712060011986e-57}, // 10^-40
+    {1e-39, 7.070712060011985e-56}, // 10^-39
+    {1e-38, 3.8080598260127236e-55}, // 10^-38
+    {1e-37, -6.632427322784916e-54}, // 10^-37
+    {1e-36, 5.8961572557722515e-53}, // 10^-36
+    {1e-35, -7.8575451945823805e-53}, // 10^-35
+    {1e-34, 7.232539610818348e-51}, // 10^-34
+    {1e-33, -5.596730997624191e-50}, // 10^-33
+    {1e-32, -5.59673099762419e-49}, // 10^-32
+    {1e-31, -8.333642060758598e-48}, // 10^-31
+    {1e-30, -8.333642060758599e-47}, // 10^-30
+    {1e-29, 5.679342582489572e-46}, // 10^-29
+    {1e-28, 2.876745653839938e-45}, // 10^-28
+    {1e-27, -3.849486974919184e-44}, // 10^-27
+    {1e-26, -3.849486974919184e-43}, // 10^-26
+    {1e-25, -3.849486974919184e-42}, // 10^-25
+    {1e-24, 7.629950044829718e-41}, // 10^-24
+    {1e-23, 3.956530198510069e-40}, // 10^-23
+    {1e-22, -4.859677432657087e-39}, // 10^-22
+    {1e-21, 9.246254777210363e-38}, // 10^-21
+    {1e-20, 5.484672854579043e-37}, // 10^-20
+    {1e-19, 2.475407316473987e-36}, // 10^-19
+    {1e-18, -7.154242405462193e-35}, // 10^-18
+    {1e-17, -7.154242405462192e-34}, // 10^-17
+    {1e-16, 2.0902213275965398e-33}, // 10^-16
+    {1e-15, -7.770539987666108e-32}, // 10^-15
+    {1e-14, 1.1806906454401013e-32}, // 10^-14
+    {1e-13, -3.037374556340037e-30}, // 10^-13
+    {1e-12, 2.0113352370744385e-29}, // 10^-12
+    {1e-11, 6.050303071806019e-28}, // 10^-11
+    {1e-10, -3.643219731549774e-27}, // 10^-10
+    {1e-09, -6.228159145777985e-26}, // 10^-9
+    {1e-08, -2.092256083012847e-25}, // 10^-8
+    {1e-07, 4.525188817411374e-24}, // 10^-7
+    {1e-06, 4.525188817411374e-23}, // 10^-6
+    {1e-05, -8.180305391403131e-22}, // 10^-5
+    {0.0001, -4.79217360238593e-21}, // 10^-4
+    {0.001, -2.0816681711721686e-20}, // 10^-3
+    {0.01, -2.0816681711721684e-19}, // 10^-2
+    {0.1, -5.551115123125783e-18}, // 10^-1
+    {1.0, 0.0}, // 10^0
+    {10.0, 0.0}, // 10^1
+    {100.0, 0.0}, // 10^2
+    {1000.0, 0.0}, // 10^3
+    {10000.0, 0.0}, // 10^4
+    {100000.0, 0.0}, // 10^5
+    {1000000.0, 0.0}, // 10^6
+    {10000000.0, 0.0}, // 10^7
+    {100000000.0, 0.0}, // 10^8
+    {1000000000.0, 0.0}, // 10^9
+    {10000000000.0, 0.0}, // 10^10
+    {100000000000.0, 0.0}, // 10^11
+    {1000000000000.0, 0.0}, // 10^12
+    {10000000000000.0, 0.0}, // 10^13
+    {100000000000000.0, 0.0}, // 10^14
+    {1000000000000000.0, 0.0}, // 10^15
+    {1e+16, 0.0}, // 10^16
+    {1e+17, 0.0}, // 10^17
+    {1e+18, 0.0}, // 10^18
+    {1e+19, 0.0}, // 10^19
+    {1e+20, 0.0}, // 10^20
+    {1e+21, 0.0}, // 10^21
+    {1e+22, 0.0}, // 10^22
+    {1e+23, 8388608.0}, // 10^23
+    {1e+24, 16777216.0}, // 10^24
+    {1e+25, -905969664.0}, // 10^25
+    {1e+26, -4764729344.0}, // 10^26
+    {1e+27, -13287555072.0}, // 10^27
+    {1e+28, 416880263168.0}, // 10^28
+    {1e+29, 8566849142784.0}, // 10^29
+    {1e+30, -19884624838656.0}, // 10^30
+    {1e+31, 364103705034752.0}, // 10^31
+    {1e+32, -5366162204393472.0}, // 10^32
+    {1e+33, 5.442476901295718e+16}, // 10^33
+    {1e+34, 5.4424769012957184e+17}, // 10^34
+    {1e+35, 3.1366338920820244e+18}, // 10^35
+    {1e+36, -4.242063737401796e+19}, // 10^36
+    {1e+37, 4.6123734179787886e+20}, // 10^37
+    {1e+38, 2.251190176543966e+21}, // 10^38
+    {1e+39, 6.029083362839682e+22}, // 10^39
+    {1e+40, -3.037860284270037e+23}, // 10^40
+    {1e+41, -6.200086450407783e+23}, // 10^41
+    {1e+42, -4.488571267807592e+25}, // 10^42
+    {1e+43, -1.393721169594141e+26}, // 10^43
+    {1e+44, -8.821361405306423e+27}, // 10^44
+    {1e+45, 7.024271097546445e+28}, // 10^45
+    {1e+46, 6.860180964052979e+28}, // 10^46
+    {1e+47, -4.38458430450762e+30}, // 10^47
+    {1e+48, -4.38458430450762e+31}, // 10^48
+    {1e+49, 5.3509723052451824e+32}, // 10^49
+    {1e+50, -7.629769841091887e+33}, // 10^50
+    {1e+51, 6.779051325638372e+33}, // 10^51
+    {1e+52, 6.779051325638372e+34}, // 10^52
+    {1e+53, 6.779051325638373e+35}, // 10^53
+    {1e+54, -7.829154040459625e+37}, // 10^54
+    {1e+55, -1.0235067020408552e+38}, // 10^55
+    {1e+56, -9.190283508143379e+39}, // 10^56
+    {1e+57, -4.834669211555366e+40}, // 10^57
+    {1e+58, 5.618805100255864e+41}, // 10^58
+    {1e+59, 2.831211950439536e+42}, // 10^59
+    {1e+60, 5.061286470292598e+43}, // 10^60
+    {1e+61, 5.061286470292598e+44}, // 10^61
+    {1e+62, -3.5021996859431613e+45}, // 10^62
+    {1e+63, -5.785795994272697e+46}  // 10^63
+};
+
+} // Namespace boost::decimal::detail::floating_power_tables
+
+#endif // BOOST_DECIMAL_DETAIL_FLOATING_POWER_TABLES_HPP
@@ -5,11 +5,512 @@
 //
 //  Specializes boost maths special functions for decimal types
 //  if using standalone mode provide them
+//
+//  The elementary functions are evaluated entirely in integer arithmetic on the
+//  significand: arguments are reduced with the tables in math_tables.hpp, a short
+//  polynomial is evaluated in 10^-16 fixed point, and the result is rounded once
+//  to decimal32. Boost.Math calls these unqualified so they are found through ADL.
 
 #ifndef BOOST_DECIMAL_DETAIL_MATH_HPP
 #define BOOST_DECIMAL_DETAIL_MATH_HPP
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include "concepts.hpp"
+#include "math_tables.hpp"
+#include "power_tables.hpp"
+#include "rounding.hpp"
+#include "uint128.hpp"
+#include "../decimal32.hpp"
+
+namespace boost::decimal {
+
+// Classification
+
+[[nodiscard]] constexpr bool isnan(decimal32 x) noexcept
+{
+    return detail::is_nan_layout(x);
+}
+
+[[nodiscard]] constexpr bool isinf(decimal32 x) noexcept
+{
+    return x.mantissa() == BOOST_DECIMAL32_INF;
+}
+
+[[nodiscard]] constexpr bool isfinite(decimal32 x) noexcept
+{
+    return x.mantissa() <= BOOST_DECIMAL32_MAN_MAX;
+}
+
+namespace detail {
+
+using math_tables::fixed_one;
+using math_tables::fixed_digits;
+
+[[nodiscard]] constexpr decimal32 signed_infinity(bool sign) noexcept
+{
+    return decimal32 {sign, BOOST_DECIMAL32_INF, BOOST_DECIMAL32_EMAX};
+}
+
+[[nodiscard]] constexpr decimal32 signed_zero(bool sign) noexcept
+{
+    return decimal32 {sign, 0, 0};
+}
+
+[[nodiscard]] constexpr std::uint64_t unsigned_abs(std::int64_t x) noexcept
+{
+    return x < 0 ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x);
+}
+
+/// lhs * rhs / 10^16 rounded half to even, where both are in 10^-16 fixed point
+[[nodiscard]] constexpr std::int64_t fixed_mul(std::int64_t lhs, std::int64_t rhs) noexcept
+{
+    constexpr auto den {static_cast<std::uint64_t>(fixed_one)};
+
+    std::uint64_t rem {};
+    std::uint64_t quot {udiv128(umul128(unsigned_abs(lhs), unsigned_abs(rhs)), den, rem)};
+
+    if (rem > den - rem || (rem == den - rem && (quot % 2) != 0))
+    {
+        ++quot;
+    }
+
+    return (lhs < 0) != (rhs < 0) ? -static_cast<std::int64_t>(quot) : static_cast<std::int64_t>(quot);
+}
+
+/// Finite x with |x| < 922 in 10^-16 fixed point
+[[nodiscard]] constexpr std::int64_t to_fixed(decimal32 x) noexcept
+{
+    const int shift {x.exponent() - (BOOST_DECIMAL32_PRECISION - 1) + fixed_digits};
+    std::uint64_t mag {x.mantissa()};
+
+    if (shift >= 0)
+    {
+        mag *= pow10(shift);
+    }
+    else if (-shift <= static_cast<int>(max_power_of_10))
+    {
+        mag = div_round_half_even(mag, pow10(-shift));
+    }
+    else
+    {
+        mag = 0;
+    }
+
+    return x.sign() ? -static_cast<std::int64_t>(mag) : static_cast<std::int64_t>(mag);
+}
+
+/// significand * 10^exp10 before rounding to the target type
+struct unrounded_result
+{
+    std::uint64_t significand;
+    int exp10;
+};
+
+/// exp(x) for x in 10^-16 fixed point with |x| <= 200
+[[nodiscard]] constexpr unrounded_result exp_fixed(std::int64_t x) noexcept
+{
+    using math_tables::ln10;
+
+    // x = n * ln(10) + k / 10 + t with |t| <= 0.05 so exp(x) = 10^n * exp(k / 10) * exp(t)
+    const std::int64_t n {(x >= 0 ? x + ln10 / 2 : x - ln10 / 2) / ln10};
+    const std::int64_t r {x - n * ln10};
+
+    constexpr std::int64_t tenth {fixed_one / 10};
+    const std::int64_t k {(r >= 0 ? r + tenth / 2 : r - tenth / 2) / tenth};
+    const std::int64_t t {r - k * tenth};
+
+    // Taylor series in Horner form, the first omitted term is below 10^-26
+    std::int64_t p {fixed_one};
+    for (int i {13}; i > 0; --i)
+    {
+        p = fixed_one + fixed_mul(t, p) / i;
+    }
+
+    const auto scale {static_cast<std::int64_t>(math_tables::exp_tenths[k + 12])};
+
+    return {static_cast<std::uint64_t>(fixed_mul(scale, p)), static_cast<int>(n) - fixed_digits};
+}
+
+/// log of significand * 10^(exponent - precision + 1) in 10^-16 fixed point for a normalized significand
+[[nodiscard]] constexpr std::int64_t log_fixed(std::uint64_t significand, int exponent) noexcept
+{
+    // m = c * (1 + u) where c is the leading two digits and 0 <= u < 0.1
+    const auto index {static_cast<std::size_t>(significand / pow10(BOOST_DECIMAL32_PRECISION - 2) - 10)};
+    const auto m {static_cast<std::int64_t>(significand * pow10(fixed_digits - BOOST_DECIMAL32_PRECISION + 1))};
+    const std::int64_t u {fixed_mul(m, static_cast<std::int64_t>(math_tables::reciprocal_leading_digits[index])) - fixed_one};
+
+    // log1p Taylor series in Horner form, 0.1^18 / 18 is below 10^-19
+    std::int64_t p {fixed_one / 17};
+    for (int i {16}; i > 0; --i)
+    {
+        p = fixed_one / i - fixed_mul(u, p);
+    }
+
+    return fixed_mul(u, p) + math_tables::log_reciprocal_leading_digits[index] + exponent * math_tables::ln10;
+}
+
+/// floor(sqrt(n)) by Newton iteration from an initial guess above the root
+[[nodiscard]] constexpr std::uint64_t isqrt(std::uint64_t n) noexcept
+{
+    if (n < 2)
+    {
+        return n;
+    }
+
+    std::uint64_t x {UINT64_C(1) << ((std::bit_width(n) + 1) / 2)};
+
+    while (true)
+    {
+        const std::uint64_t y {(x + n / x) / 2};
+        if (y >= x)
+        {
+            return x;
+        }
+
+        x = y;
+    }
+}
+
+/// Multiplies by 10^n, n may exceed the size of the power table
+[[nodiscard]] constexpr uint128 mul_pow10(uint128 x, int n) noexcept
+{
+    for (; n > 0; n -= static_cast<int>(max_power_of_10))
+    {
+        x = umul128(x, pow10(n < static_cast<int>(max_power_of_10) ? n : static_cast<int>(max_power_of_10)));
+    }
+
+    return x;
+}
+
+/// Correctly rounded lhs_sig * 10^lhs_exp + rhs_sig * 10^rhs_exp with the given signs
+[[nodiscard]] constexpr decimal32 add_significands(bool lhs_sign, std::uint64_t lhs_sig, int lhs_exp,
+                                                   bool rhs_sign, std::uint64_t rhs_sig, int rhs_exp) noexcept
+{
+    if (rhs_exp + num_digits(rhs_sig) > lhs_exp + num_digits(lhs_sig))
+    {
+        std::swap(lhs_sign, rhs_sign);
+        std::swap(lhs_sig, rhs_sig);
+        std::swap(lhs_exp, rhs_exp);
+    }
+
+    // Align at a common exponent keeping at most 37 digits of lhs, which fits in 128 bits.
+    // Anything of rhs below that only matters as a sticky digit
+    const int lhs_lead {lhs_exp + num_digits(lhs_sig)};
+    const int common_exp {(std::max)((std::min)(lhs_exp, rhs_exp), lhs_lead - 37)};
+
+    const uint128 lhs {mul_pow10({0, lhs_sig}, lhs_exp - common_exp)};
+    uint128 rhs {};
+    bool sticky {false};
+
+    if (rhs_exp >= common_exp)
+    {
+        rhs = mul_pow10({0, rhs_sig}, rhs_exp - common_exp);
+    }
+    else if (common_exp - rhs_exp <= static_cast<int>(max_power_of_10))
+    {
+        rhs.low = rhs_sig / pow10(common_exp - rhs_exp);
+        sticky = rhs_sig % pow10(common_exp - rhs_exp) != 0;
+    }
+    else
+    {
+        sticky = true;
+    }
+
+    // With sticky set the exact result lies strictly between result and result + 1
+    uint128 result {};
+    bool result_sign {lhs_sign};
+
+    if (lhs_sign == rhs_sign)
+    {
+        result = lhs + rhs;
+    }
+    else if (sticky)
+    {
+        result = lhs - rhs - uint128 {0, 1};
+    }
+    else if (lhs >= rhs)
+    {
+        result = lhs - rhs;
+    }
+    else
+    {
+        result = rhs - lhs;
+        result_sign = rhs_sign;
+    }
+
+    int result_exp {common_exp};
+    while (result.high != 0)
+    {
+        std::uint64_t rem {};
+        result = udiv128_wide(result, 10, rem);
+        sticky = sticky || rem != 0;
+        ++result_exp;
+    }
+
+    // Dropped digits never sit on a rounding boundary once the last kept digit is non-zero
+    if (sticky && result.low % 10 == 0)
+    {
+        ++result.low;
+    }
+
+    if (result.low == 0)
+    {
+        return decimal32 {};
+    }
+
+    return make_decimal32(result_sign, result.low, result_exp);
+}
+
+/// Whether finite y is an integer, and if so whether it is odd
+[[nodiscard]] constexpr std::pair<bool, bool> integer_parity(decimal32 y) noexcept
+{
+    const int exp10 {y.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+    const std::uint64_t sig {y.mantissa()};
+
+    if (sig == 0 || exp10 > 0)
+    {
+        return {true, false};
+    }
+
+    if (-exp10 >= BOOST_DECIMAL32_PRECISION)
+    {
+        return {false, false};
+    }
+
+    const std::uint64_t scale {pow10(-exp10)};
+    return {sig % scale == 0, (sig / scale) % 2 != 0};
+}
+
+} // Namespace detail
+
+[[nodiscard]] constexpr decimal32 sqrt(decimal32 x) noexcept
+{
+    if (isnan(x) || x.mantissa() == 0)
+    {
+        return x;
+    }
+
+    if (x.sign())
+    {
+        return std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    if (isinf(x))
+    {
+        return x;
+    }
+
+    std::uint64_t sig {x.mantissa()};
+    int exp10 {x.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+
+    if ((exp10 & 1) != 0)
+    {
+        sig *= 10;
+        --exp10;
+    }
+
+    // Widen to 17 or 18 digits so the integer root has two guard digits
+    sig *= detail::pow10(10);
+    exp10 -= 10;
+
+    std::uint64_t root {detail::isqrt(sig)};
+    if (root * root != sig && root % 10 == 0)
+    {
+        ++root;
+    }
+
+    return detail::make_decimal32(false, root, exp10 / 2);
+}
+
+[[nodiscard]] constexpr decimal32 exp(decimal32 x) noexcept
+{
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (isinf(x))
+    {
+        return x.sign() ? decimal32 {} : x;
+    }
+
+    // exp(200) is far beyond the largest decimal32 and exp(-200) far below the smallest
+    if (x.exponent() > 2 || (x.exponent() == 2 && x.mantissa() >= 2 * BOOST_DECIMAL32_MAN_MIN))
+    {
+        return x.sign() ? decimal32 {} : detail::signed_infinity(false);
+    }
+
+    const auto result {detail::exp_fixed(detail::to_fixed(x))};
+    return detail::make_decimal32(false, result.significand, result.exp10);
+}
+
+[[nodiscard]] constexpr decimal32 log(decimal32 x) noexcept
+{
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (x.mantissa() == 0)
+    {
+        return detail::signed_infinity(true);
+    }
+
+    if (x.sign())
+    {
+        return std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    if (isinf(x))
+    {
+        return x;
+    }
+
+    const std::int64_t result {detail::log_fixed(x.mantissa(), x.exponent())};
+    return detail::make_decimal32(result < 0, detail::unsigned_abs(result), -detail::fixed_digits);
+}
+
+[[nodiscard]] constexpr decimal32 pow(decimal32 x, decimal32 y) noexcept
+{
+    constexpr decimal32 one {1, 0};
+
+    if (y.mantissa() == 0)
+    {
+        return one;
+    }
+
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (isnan(y))
+    {
+        return y;
+    }
+
+    const auto [y_integer, y_odd] {isinf(y) ? std::pair<bool, bool> {true, false} : detail::integer_parity(y)};
+    const bool result_sign {x.sign() && y_odd};
+
+    if (x.mantissa() == 0)
+    {
+        return y.sign() ? detail::signed_infinity(result_sign) : decimal32 {};
+    }
+
+    if (isinf(x))
+    {
+        return y.sign() ? decimal32 {} : detail::signed_infinity(result_sign);
+    }
+
+    if (x.sign() && !y_integer)
+    {
+        return std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    const bool x_is_one {x.mantissa() == BOOST_DECIMAL32_MAN_MIN && x.exponent() == 0};
+
+    if (isinf(y))
+    {
+        if (x_is_one)
+        {
+            return one;
+        }
+
+        const bool magnitude_above_one {x.exponent() >= 0};
+        return magnitude_above_one != static_cast<bool>(y.sign()) ? detail::signed_infinity(false) : decimal32 {};
+    }
+
+    // x^y = exp(y * log|x|) with the product formed exactly from the integer significand of y
+    const std::int64_t log_x {detail::log_fixed(x.mantissa(), x.exponent())};
+    const bool exponent_negative {(log_x < 0) != static_cast<bool>(y.sign())};
+
+    constexpr std::uint64_t saturation {200 * static_cast<std::uint64_t>(detail::fixed_one)};
+    detail::uint128 product {detail::umul128(detail::unsigned_abs(log_x), y.mantissa())};
+
+    int shift {y.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+
+    // Scaling up stops once saturated since the product only grows from there
+    for (; shift > 0 && product.high == 0 && product.low <= saturation; --shift)
+    {
+        product = detail::umul128(product, 10);
+    }
+
+    while (shift < 0)
+    {
+        const int step {(std::min)(-shift, static_cast<int>(detail::max_power_of_10))};
+        std::uint64_t rem {};
+        product = detail::udiv128_wide(product, detail::pow10(step), rem);
+        shift += step;
+    }
+
+    if (product.high != 0 || product.low > saturation)
+    {
+        return exponent_negative ? decimal32 {} : detail::signed_infinity(result_sign);
+    }
+
+    const auto magnitude {static_cast<std::int64_t>(product.low)};
+    const auto result {detail::exp_fixed(exponent_negative ? -magnitude : magnitude)};
+
+    return detail::make_decimal32(result_sign, result.significand, result.exp10);
+}
+
+/// x * y + z rounded once
+[[nodiscard]] constexpr decimal32 fma(decimal32 x, decimal32 y, decimal32 z) noexcept
+{
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (isnan(y))
+    {
+        return y;
+    }
+
+    if (isnan(z))
+    {
+        return z;
+    }
+
+    const bool product_sign {x.sign() != y.sign()};
+
+    if (isinf(x) || isinf(y))
+    {
+        if (x.mantissa() == 0 || y.mantissa() == 0 || (isinf(z) && static_cast<bool>(z.sign()) != product_sign))
+        {
+            return std::numeric_limits<decimal32>::quiet_NaN();
+        }
+
+        return detail::signed_infinity(product_sign);
+    }
+
+    if (isinf(z))
+    {
+        return z;
+    }
+
+    const std::uint64_t product {static_cast<std::uint64_t>(x.mantissa()) * y.mantissa()};
+    const int product_exp {x.exponent() + y.exponent() - 2 * (BOOST_DECIMAL32_PRECISION - 1)};
+
+    if (product == 0)
+    {
+        return z;
+    }
+
+    if (z.mantissa() == 0)
+    {
+        return detail::make_decimal32(product_sign, product, product_exp);
+    }
+
+    return detail::add_significands(product_sign, product, product_exp,
+                                    z.sign(), z.mantissa(), z.exponent() - (BOOST_DECIMAL32_PRECISION - 1));
+}
+
+} // Namespace boost::decimal
 
 #ifndef BOOST_DECIMAL_STANDALONE
 
@@ -0,0 +1,240 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Precomputed constants for the elementary functions. Every entry is an integer
+//  in units of 10^-16 correctly rounded from a 60 digit evaluation.
+
+#ifndef BOOST_DECIMAL_DETAIL_MATH_TABLES_HPP
+#define BOOST_DECIMAL_DETAIL_MATH_TABLES_HPP
+
+#include <cstdint>
+
+namespace boost::decimal::detail::math_tables {
+
+inline constexpr int fixed_digits {16};
+inline constexpr std::int64_t fixed_one {INT64_C(10000000000000000)};
+
+inline constexpr std::int64_t ln10 {INT64_C(23025850929940457)};
+
+/// exp(k / 10) for k in [-12, 12], indexed by k + 12
+inline constexpr std::uint64_t exp_tenths[25] = {
+    UINT64_C(3011942119122021), // exp(-1.2)
+    UINT64_C(3328710836980796), // exp(-1.1)
+    UINT64_C(3678794411714423), // exp(-1.0)
+    UINT64_C(4065696597405991), // exp(-0.9)
+    UINT64_C(4493289641172216), // exp(-0.8)
+    UINT64_C(4965853037914095), // exp(-0.7)
+    UINT64_C(5488116360940264), // exp(-0.6)
+    UINT64_C(6065306597126334), // exp(-0.5)
+    UINT64_C(6703200460356393), // exp(-0.4)
+    UINT64_C(7408182206817179), // exp(-0.3)
+    UINT64_C(8187307530779819), // exp(-0.2)
+    UINT64_C(9048374180359596), // exp(-0.1)
+    UINT64_C(10000000000000000), // exp(0.0)
+    UINT64_C(11051709180756476), // exp(0.1)
+    UINT64_C(12214027581601698), // exp(0.2)
+    UINT64_C(13498588075760031), // exp(0.3)
+    UINT64_C(14918246976412703), // exp(0.4)
+    UINT64_C(16487212707001281), // exp(0.5)
+    UINT64_C(18221188003905090), // exp(0.6)
+    UINT64_C(20137527074704765), // exp(0.7)
+    UINT64_C(22255409284924676), // exp(0.8)
+    UINT64_C(24596031111569497), // exp(0.9)
+    UINT64_C(27182818284590452), // exp(1.0)
+    UINT64_C(30041660239464331), // exp(1.1)
+    UINT64_C(33201169227365475)  // exp(1.2)
+};
+
+/// Rounded reciprocals of the leading two significant digits c = 1.0, 1.1, ..., 9.9
+inline constexpr std::uint64_t reciprocal_leading_digits[90] = {
+    UINT64_C(10000000000000000), // 1 / 1.0
+    UINT64_C(9090909090909091), // 1 / 1.1
+    UINT64_C(8333333333333333), // 1 / 1.2
+    UINT64_C(7692307692307692), // 1 / 1.3
+    UINT64_C(7142857142857143), // 1 / 1.4
+    UINT64_C(6666666666666667), // 1 / 1.5
+    UINT64_C(6250000000000000), // 1 / 1.6
+    UINT64_C(5882352941176471), // 1 / 1.7
+    UINT64_C(5555555555555556), // 1 / 1.8
+    UINT64_C(5263157894736842), // 1 / 1.9
+    UINT64_C(5000000000000000), // 1 / 2.0
+    UINT64_C(4761904761904762), // 1 / 2.1
+    UINT64_C(4545454545454545), // 1 / 2.2
+    UINT64_C(4347826086956522), // 1 / 2.3
+    UINT64_C(4166666666666667), // 1 / 2.4
+    UINT64_C(4000000000000000), // 1 / 2.5
+    UINT64_C(3846153846153846), // 1 / 2.6
+    UINT64_C(3703703703703704), // 1 / 2.7
+    UINT64_C(3571428571428571), // 1 / 2.8
+    UINT64_C(3448275862068966), // 1 / 2.9
+    UINT64_C(3333333333333333), // 1 / 3.0
+    UINT64_C(3225806451612903), // 1 / 3.1
+    UINT64_C(3125000000000000), // 1 / 3.2
+    UINT64_C(3030303030303030), // 1 / 3.3
+    UINT64_C(2941176470588235), // 1 / 3.4
+    UINT64_C(2857142857142857), // 1 / 3.5
+    UINT64_C(2777777777777778), // 1 / 3.6
+    UINT64_C(2702702702702703), // 1 / 3.7
+    UINT64_C(2631578947368421), // 1 / 3.8
+    UINT64_C(2564102564102564), // 1 / 3.9
+    UINT64_C(2500000000000000), // 1 / 4.0
+    UINT64_C(2439024390243902), // 1 / 4.1
+    UINT64_C(2380952380952381), // 1 / 4.2
+    UINT64_C(2325581395348837), // 1 / 4.3
+    UINT64_C(2272727272727273), // 1 / 4.4
+    UINT64_C(2222222222222222), // 1 / 4.5
+    UINT64_C(2173913043478261), // 1 / 4.6
+    UINT64_C(2127659574468085), // 1 / 4.7
+    UINT64_C(2083333333333333), // 1 / 4.8
+    UINT64_C(2040816326530612), // 1 / 4.9
+    UINT64_C(2000000000000000), // 1 / 5.0
+    UINT64_C(1960784313725490), // 1 / 5.1
+    UINT64_C(1923076923076923), // 1 / 5.2
+    UINT64_C(1886792452830189), // 1 / 5.3
+    UINT64_C(1851851851851852), // 1 / 5.4
+    UINT64_C(1818181818181818), // 1 / 5.5
+    UINT64_C(1785714285714286), // 1 / 5.6
+    UINT64_C(1754385964912281), // 1 / 5.7
+    UINT64_C(1724137931034483), // 1 / 5.8
+    UINT64_C(1694915254237288), // 1 / 5.9
+    UINT64_C(1666666666666667), // 1 / 6.0
+    UINT64_C(1639344262295082), // 1 / 6.1
+    UINT64_C(1612903225806452), // 1 / 6.2
+    UINT64_C(1587301587301587), // 1 / 6.3
+    UINT64_C(1562500000000000), // 1 / 6.4
+    UINT64_C(1538461538461538), // 1 / 6.5
+    UINT64_C(1515151515151515), // 1 / 6.6
+    UINT64_C(1492537313432836), // 1 / 6.7
+    UINT64_C(1470588235294118), // 1 / 6.8
+    UINT64_C(1449275362318841), // 1 / 6.9
+    UINT64_C(1428571428571429), // 1 / 7.0
+    UINT64_C(1408450704225352), // 1 / 7.1
+    UINT64_C(1388888888888889), // 1 / 7.2
+    UINT64_C(1369863013698630), // 1 / 7.3
+    UINT64_C(1351351351351351), // 1 / 7.4
+    UINT64_C(1333333333333333), // 1 / 7.5
+    UINT64_C(1315789473684211), // 1 / 7.6
+    UINT64_C(1298701298701299), // 1 / 7.7
+    UINT64_C(1282051282051282), // 1 / 7.8
+    UINT64_C(1265822784810127), // 1 / 7.9
+    UINT64_C(1250000000000000), // 1 / 8.0
+    UINT64_C(1234567901234568), // 1 / 8.1
+    UINT64_C(1219512195121951), // 1 / 8.2
+    UINT64_C(1204819277108434), // 1 / 8.3
+    UINT64_C(1190476190476190), // 1 / 8.4
+    UINT64_C(1176470588235294), // 1 / 8.5
+    UINT64_C(1162790697674419), // 1 / 8.6
+    UINT64_C(1149425287356322), // 1 / 8.7
+    UINT64_C(1136363636363636), // 1 / 8.8
+    UINT64_C(1123595505617978), // 1 / 8.9
+    UINT64_C(1111111111111111), // 1 / 9.0
+    UINT64_C(1098901098901099), // 1 / 9.1
+    UINT64_C(1086956521739130), // 1 / 9.2
+    UINT64_C(1075268817204301), // 1 / 9.3
+    UINT64_C(1063829787234043), // 1 / 9.4
+    UINT64_C(1052631578947368), // 1 / 9.5
+    UINT64_C(1041666666666667), // 1 / 9.6
+    UINT64_C(1030927835051546), // 1 / 9.7
+    UINT64_C(1020408163265306), // 1 / 9.8
+    UINT64_C(1010101010101010)  // 1 / 9.9
+};
+
+/// -log of the stored reciprocal, so that log(m) == log(m * reciprocal) + entry exactly
+inline constexpr std::int64_t log_reciprocal_leading_digits[90] = {
+    INT64_C(0), // -log(1 / 1.0)
+    INT64_C(953101798043249), // -log(1 / 1.1)
+    INT64_C(1823215567939547), // -log(1 / 1.2)
+    INT64_C(2623642644674911), // -log(1 / 1.3)
+    INT64_C(3364722366212129), // -log(1 / 1.4)
+    INT64_C(4054651081081643), // -log(1 / 1.5)
+    INT64_C(4700036292457356), // -log(1 / 1.6)
+    INT64_C(5306282510621703), // -log(1 / 1.7)
+    INT64_C(5877866649021189), // -log(1 / 1.8)
+    INT64_C(6418538861723948), // -log(1 / 1.9)
+    INT64_C(6931471805599453), // -log(1 / 2.0)
+    INT64_C(7419373447293773), // -log(1 / 2.1)
+    INT64_C(7884573603642703), // -log(1 / 2.2)
+    INT64_C(8329091229351039), // -log(1 / 2.3)
+    INT64_C(8754687373538999), // -log(1 / 2.4)
+    INT64_C(9162907318741551), // -log(1 / 2.5)
+    INT64_C(9555114450274364), // -log(1 / 2.6)
+    INT64_C(9932517730102833), // -log(1 / 2.7)
+    INT64_C(10296194171811584), // -log(1 / 2.8)
+    INT64_C(10647107369924282), // -log(1 / 2.9)
+    INT64_C(10986122886681098), // -log(1 / 3.0)
+    INT64_C(11314021114911006), // -log(1 / 3.1)
+    INT64_C(11631508098056809), // -log(1 / 3.2)
+    INT64_C(11939224684724347), // -log(1 / 3.3)
+    INT64_C(12237754316221158), // -log(1 / 3.4)
+    INT64_C(12527629684953680), // -log(1 / 3.5)
+    INT64_C(12809338454620642), // -log(1 / 3.6)
+    INT64_C(13083328196501787), // -log(1 / 3.7)
+    INT64_C(13350010667323401), // -log(1 / 3.8)
+    INT64_C(13609765531356008), // -log(1 / 3.9)
+    INT64_C(13862943611198906), // -log(1 / 4.0)
+    INT64_C(14109869737102623), // -log(1 / 4.1)
+    INT64_C(14350845252893226), // -log(1 / 4.2)
+    INT64_C(14586150226995168), // -log(1 / 4.3)
+    INT64_C(14816045409242154), // -log(1 / 4.4)
+    INT64_C(15040773967762742), // -log(1 / 4.5)
+    INT64_C(15260563034950493), // -log(1 / 4.6)
+    INT64_C(15475625087160130), // -log(1 / 4.7)
+    INT64_C(15686159179138454), // -log(1 / 4.8)
+    INT64_C(15892352051165810), // -log(1 / 4.9)
+    INT64_C(16094379124341004), // -log(1 / 5.0)
+    INT64_C(16292405397302802), // -log(1 / 5.1)
+    INT64_C(16486586255873817), // -log(1 / 5.2)
+    INT64_C(16677068205580760), // -log(1 / 5.3)
+    INT64_C(16863989535702286), // -log(1 / 5.4)
+    INT64_C(17047480922384253), // -log(1 / 5.5)
+    INT64_C(17227665977411034), // -log(1 / 5.6)
+    INT64_C(17404661748405043), // -log(1 / 5.7)
+    INT64_C(17578579175523735), // -log(1 / 5.8)
+    INT64_C(17749523509116738), // -log(1 / 5.9)
+    INT64_C(17917594692280548), // -log(1 / 6.0)
+    INT64_C(18082887711792655), // -log(1 / 6.1)
+    INT64_C(18245492920510456), // -log(1 / 6.2)
+    INT64_C(18405496333974872), // -log(1 / 6.3)
+    INT64_C(18562979903656262), // -log(1 / 6.4)
+    INT64_C(18718021769015917), // -log(1 / 6.5)
+    INT64_C(18870696490323800), // -log(1 / 6.6)
+    INT64_C(19021075263969203), // -log(1 / 6.7)
+    INT64_C(19169226121820608), // -log(1 / 6.8)
+    INT64_C(19315214116032134), // -log(1 / 6.9)
+    INT64_C(19459101490553130), // -log(1 / 7.0)
+    INT64_C(19600947840472698), // -log(1 / 7.1)
+    INT64_C(19740810260220095), // -log(1 / 7.2)
+    INT64_C(19878743481543455), // -log(1 / 7.3)
+    INT64_C(20014800002101243), // -log(1 / 7.4)
+    INT64_C(20149030205422650), // -log(1 / 7.5)
+    INT64_C(20281482472922850), // -log(1 / 7.6)
+    INT64_C(20412203288596379), // -log(1 / 7.7)
+    INT64_C(20541237336955461), // -log(1 / 7.8)
+    INT64_C(20668627594729755), // -log(1 / 7.9)
+    INT64_C(20794415416798359), // -log(1 / 8.0)
+    INT64_C(20918640616783930), // -log(1 / 8.1)
+    INT64_C(21041341542702076), // -log(1 / 8.2)
+    INT64_C(21162555148025520), // -log(1 / 8.3)
+    INT64_C(21282317058492683), // -log(1 / 8.4)
+    INT64_C(21400661634962709), // -log(1 / 8.5)
+    INT64_C(21517622032594617), // -log(1 / 8.6)
+    INT64_C(21633230256605379), // -log(1 / 8.7)
+    INT64_C(21747517214841611), // -log(1 / 8.8)
+    INT64_C(21860512767380937), // -log(1 / 8.9)
+    INT64_C(21972245773362195), // -log(1 / 9.0)
+    INT64_C(22082744135228043), // -log(1 / 9.1)
+    INT64_C(22192034840549950), // -log(1 / 9.2)
+    INT64_C(22300144001592103), // -log(1 / 9.3)
+    INT64_C(22407096892759578), // -log(1 / 9.4)
+    INT64_C(22512917986064956), // -log(1 / 9.5)
+    INT64_C(22617630984737902), // -log(1 / 9.6)
+    INT64_C(22721258855093375), // -log(1 / 9.7)
+    INT64_C(22823823856765264), // -log(1 / 9.8)
+    INT64_C(22925347571405443)  // -log(1 / 9.9)
+};
+
+} // Namespace boost::decimal::detail::math_tables
+
+#endif // BOOST_DECIMAL_DETAIL_MATH_TABLES_HPP
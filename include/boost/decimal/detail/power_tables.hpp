@@ -0,0 +1,93 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Compile-time powers of ten and digit counting for the integer significand paths
+
+#ifndef BOOST_DECIMAL_DETAIL_POWER_TABLES_HPP
+#define BOOST_DECIMAL_DETAIL_POWER_TABLES_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include "floating_power_tables.hpp"
+
+namespace boost::decimal::detail {
+
+/// 10^0 through 10^19 (the largest power of ten representable in std::uint64_t)
+inline constexpr std::uint64_t powers_of_10[20] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000),
+    UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000),
+    UINT64_C(10000000000), UINT64_C(100000000000), UINT64_C(1000000000000),
+    UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000),
+    UINT64_C(10000000000000000000)
+};
+
+inline constexpr std::size_t max_power_of_10 = sizeof(powers_of_10) / sizeof(powers_of_10[0]) - 1;
+
+[[nodiscard]] constexpr std::uint64_t pow10(int n) noexcept
+{
+    return powers_of_10[n];
+}
+
+/// Multiply-shift reciprocals of 10^0 through 10^7. For every n < 2^24, which covers every
+/// decimal32 significand, n / 10^k == (n * multiplier) >> shift. Verified exhaustively.
+struct pow10_reciprocal
+{
+    std::uint64_t multiplier;
+    int shift;
+};
+
+inline constexpr pow10_reciprocal pow10_reciprocals_24bit[8] = {
+    {UINT64_C(16777216), 24},
+    {UINT64_C(26843546), 28},
+    {UINT64_C(21474837), 31},
+    {UINT64_C(17179870), 34},
+    {UINT64_C(27487791), 38},
+    {UINT64_C(21990233), 41},
+    {UINT64_C(17592187), 44},
+    {UINT64_C(28147498), 48}
+};
+
+/// n / 10^k without a hardware divide for n < 2^24 and 0 <= k <= 7
+[[nodiscard]] constexpr std::uint32_t div_pow10_24bit(std::uint32_t n, int k) noexcept
+{
+    const auto& reciprocal {pow10_reciprocals_24bit[k]};
+    return static_cast<std::uint32_t>((n * reciprocal.multiplier) >> reciprocal.shift);
+}
+
+/// Number of decimal digits in x, where 0 is considered to have 1 digit
+[[nodiscard]] constexpr int num_digits(std::uint64_t x) noexcept
+{
+    int digits {1};
+    while (digits <= static_cast<int>(max_power_of_10) && x >= powers_of_10[digits])
+    {
+        ++digits;
+    }
+
+    return digits;
+}
+
+/// significand * 10^exp10 correctly rounded to double for significand < 2^26 and exp10
+/// within the table. The product with the high part is formed exactly by splitting it into
+/// two halves of at most 27 bits, and the low part then only has to correct the rounding
+[[nodiscard]] constexpr double significand_to_double(std::uint32_t significand, int exp10) noexcept
+{
+    const auto& power {floating_power_tables::powers_of_10[exp10 - floating_power_tables::min_exponent]};
+    const auto sig {static_cast<double>(significand)};
+
+    // Veltkamp split of the high part
+    const double scaled {134217729.0 * power.high};
+    const double high_upper {scaled - (scaled - power.high)};
+    const double high_lower {power.high - high_upper};
+
+    const double product {sig * power.high};
+    const double product_error {(sig * high_upper - product) + sig * high_lower};
+
+    return product + (product_error + sig * power.low);
+}
+
+} // Namespace boost::decimal::detail
+
+#endif // BOOST_DECIMAL_DETAIL_POWER_TABLES_HPP
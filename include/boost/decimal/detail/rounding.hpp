@@ -0,0 +1,75 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Integer division with decimal rounding used when discarding significand digits
+
+#ifndef BOOST_DECIMAL_DETAIL_ROUNDING_HPP
+#define BOOST_DECIMAL_DETAIL_ROUNDING_HPP
+
+namespace boost::decimal {
+
+/// Rounding direction for operations that discard digits, following IEEE 754-2019 4.3
+enum class rounding_mode
+{
+    fe_dec_to_nearest,           // Ties to even
+    fe_dec_to_nearest_from_zero, // Ties away from zero
+    fe_dec_toward_zero,
+    fe_dec_upward,
+    fe_dec_downward
+};
+
+namespace detail {
+
+/// Whether discarding a remainder rem of den from a quotient of magnitude quot should
+/// increment the magnitude, with rem_vs_half the sign of rem - den / 2
+[[nodiscard]] constexpr bool round_magnitude_up(rounding_mode mode, bool negative, bool quot_is_odd,
+                                                bool inexact, int rem_vs_half) noexcept
+{
+    switch (mode)
+    {
+        case rounding_mode::fe_dec_to_nearest:
+            return rem_vs_half > 0 || (rem_vs_half == 0 && quot_is_odd);
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            return rem_vs_half >= 0 && inexact;
+        case rounding_mode::fe_dec_toward_zero:
+            return false;
+        case rounding_mode::fe_dec_upward:
+            return inexact && !negative;
+        case rounding_mode::fe_dec_downward:
+            return inexact && negative;
+    }
+
+    return false;
+}
+
+/// Sign of rem - den / 2 without forming rem * 2
+template <typename T>
+[[nodiscard]] constexpr int compare_to_half(T rem, T den) noexcept
+{
+    const T den_less_rem {static_cast<T>(den - rem)};
+    return rem > den_less_rem ? 1 : (rem == den_less_rem ? 0 : -1);
+}
+
+/// Divides the magnitude num by den rounding to nearest with ties to even
+template <typename T>
+[[nodiscard]] constexpr T div_round_half_even(T num, T den) noexcept
+{
+    const T quot {static_cast<T>(num / den)};
+    const T rem {static_cast<T>(num % den)};
+    const int rem_vs_half {compare_to_half(rem, den)};
+
+    if (rem_vs_half > 0 || (rem_vs_half == 0 && (quot % 2) != 0))
+    {
+        return static_cast<T>(quot + 1);
+    }
+
+    return quot;
+}
+
+} // Namespace detail
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_DETAIL_ROUNDING_HPP
@@ -0,0 +1,170 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Minimal unsigned 128-bit arithmetic for exact intermediate significands.
+//  Uses the native type when the compiler provides one and 64-bit limbs otherwise.
+
+#ifndef BOOST_DECIMAL_DETAIL_UINT128_HPP
+#define BOOST_DECIMAL_DETAIL_UINT128_HPP
+
+#include <bit>
+#include <cstdint>
+#include <compare>
+#include "../tools/config.hpp"
+
+namespace boost::decimal::detail {
+
+#ifdef BOOST_DECIMAL_HAS_INT128
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+struct uint128
+{
+    std::uint64_t high;
+    std::uint64_t low;
+
+    constexpr bool operator==(const uint128& rhs) const noexcept = default;
+    constexpr auto operator<=>(const uint128& rhs) const noexcept = default;
+};
+
+[[nodiscard]] constexpr uint128 operator+(uint128 lhs, uint128 rhs) noexcept
+{
+    const std::uint64_t low {lhs.low + rhs.low};
+    return {lhs.high + rhs.high + (low < lhs.low ? 1U : 0U), low};
+}
+
+[[nodiscard]] constexpr uint128 operator-(uint128 lhs, uint128 rhs) noexcept
+{
+    const std::uint64_t low {lhs.low - rhs.low};
+    return {lhs.high - rhs.high - (lhs.low < rhs.low ? 1U : 0U), low};
+}
+
+/// Full 64 x 64 -> 128-bit product
+[[nodiscard]] constexpr uint128 umul128(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+    #ifdef BOOST_DECIMAL_HAS_INT128
+
+    const auto product {static_cast<uint128_t>(lhs) * rhs};
+    return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+
+    #else
+
+    const std::uint64_t lhs_low {lhs & UINT32_MAX};
+    const std::uint64_t lhs_high {lhs >> 32};
+    const std::uint64_t rhs_low {rhs & UINT32_MAX};
+    const std::uint64_t rhs_high {rhs >> 32};
+
+    const std::uint64_t low_low {lhs_low * rhs_low};
+    const std::uint64_t high_low {lhs_high * rhs_low};
+    const std::uint64_t low_high {lhs_low * rhs_high};
+    const std::uint64_t high_high {lhs_high * rhs_high};
+
+    const std::uint64_t middle {(low_low >> 32) + (high_low & UINT32_MAX) + low_high};
+
+    return {high_high + (high_low >> 32) + (middle >> 32), (middle << 32) | (low_low & UINT32_MAX)};
+
+    #endif
+}
+
+/// Product of a 128-bit and a 64-bit value truncated to 128 bits
+[[nodiscard]] constexpr uint128 umul128(uint128 lhs, std::uint64_t rhs) noexcept
+{
+    const uint128 low_product {umul128(lhs.low, rhs)};
+    return {low_product.high + lhs.high * rhs, low_product.low};
+}
+
+/// 128 / 64 -> 64-bit quotient. Requires num.high < den so that the quotient fits
+[[nodiscard]] constexpr std::uint64_t udiv128(uint128 num, std::uint64_t den, std::uint64_t& rem) noexcept
+{
+    #ifdef BOOST_DECIMAL_HAS_INT128
+
+    const auto wide_num {(static_cast<uint128_t>(num.high) << 64) | num.low};
+    rem = static_cast<std::uint64_t>(wide_num % den);
+    return static_cast<std::uint64_t>(wide_num / den);
+
+    #else
+
+    // Restoring shift-subtract division, one quotient bit per step
+    std::uint64_t r {num.high};
+    std::uint64_t q {};
+
+    for (int i {63}; i >= 0; --i)
+    {
+        const bool carry {(r >> 63) != 0};
+        r = (r << 1) | ((num.low >> i) & 1U);
+        q <<= 1;
+
+        if (carry || r >= den)
+        {
+            r -= den;
+            q |= 1U;
+        }
+    }
+
+    rem = r;
+    return q;
+
+    #endif
+}
+
+/// 128 / 64 -> 128-bit quotient without preconditions on the magnitude of num
+[[nodiscard]] constexpr uint128 udiv128_wide(uint128 num, std::uint64_t den, std::uint64_t& rem) noexcept
+{
+    const std::uint64_t high {num.high / den};
+    const std::uint64_t low {udiv128({num.high % den, num.low}, den, rem)};
+
+    return {high, low};
+}
+
+/// Precomputed reciprocal for repeated 128 / 64 division by the same divisor, following
+/// Moller and Granlund, "Improved division by invariant integers" (2011)
+struct uint128_divisor
+{
+    std::uint64_t divisor;    // Shifted so that the top bit is set
+    std::uint64_t reciprocal; // floor((2^128 - 1) / divisor) - 2^64
+    int shift;
+};
+
+[[nodiscard]] constexpr uint128_divisor make_uint128_divisor(std::uint64_t den) noexcept
+{
+    const int shift {std::countl_zero(den)};
+    const std::uint64_t divisor {den << shift};
+
+    std::uint64_t rem {};
+    return {divisor, udiv128({~divisor, ~UINT64_C(0)}, divisor, rem), shift};
+}
+
+/// 128 / 64 -> 64-bit quotient by a precomputed divisor with one multiplication and at most
+/// two corrections. Requires num.high < den so that the quotient fits
+[[nodiscard]] constexpr std::uint64_t udiv128(uint128 num, const uint128_divisor& den, std::uint64_t& rem) noexcept
+{
+    const int shift {den.shift};
+    const std::uint64_t high {shift == 0 ? num.high : (num.high << shift) | (num.low >> (64 - shift))};
+    const std::uint64_t low {num.low << shift};
+
+    uint128 estimate {umul128(den.reciprocal, high) + uint128 {high, low}};
+    ++estimate.high;
+
+    std::uint64_t r {low - estimate.high * den.divisor};
+
+    if (r > estimate.low)
+    {
+        --estimate.high;
+        r += den.divisor;
+    }
+
+    if (r >= den.divisor)
+    {
+        ++estimate.high;
+        r -= den.divisor;
+    }
+
+    rem = r >> shift;
+    return estimate.high;
+}
+
+} // Namespace boost::decimal::detail
+
+#endif // BOOST_DECIMAL_DETAIL_UINT128_HPP
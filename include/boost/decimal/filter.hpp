@@ -0,0 +1,355 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Predicate kernels over contiguous ranges of decimal32 producing packed bitmasks.
+//  Bit i % 64 of mask word i / 64 is set when element i satisfies the predicate and
+//  bits past the end of the input are cleared. Each kernel returns the number of set bits.
+//
+//  Every comparison reduces to a signed integer compare of detail::ordering_key, which
+//  the AVX2 path computes directly from the bit layout eight elements at a time. The
+//  scalar path uses the decimal32 operators and gives identical results.
+//  Define BOOST_DECIMAL_DISABLE_SIMD to always use the scalar path.
+
+#ifndef BOOST_DECIMAL_FILTER_HPP
+#define BOOST_DECIMAL_FILTER_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include "decimal32.hpp"
+#include "detail/math.hpp"
+
+#if defined(__AVX2__) && !defined(BOOST_DECIMAL_DISABLE_SIMD) && \
+    defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  include <immintrin.h>
+#  define BOOST_DECIMAL_FILTER_AVX2
+#endif
+
+namespace boost::decimal {
+
+enum class compare_op
+{
+    less,
+    less_equal,
+    greater,
+    greater_equal,
+    equal,
+    not_equal
+};
+
+/// Number of 64-bit mask words required for n elements
+[[nodiscard]] constexpr std::size_t mask_words(std::size_t n) noexcept
+{
+    return (n + 63) / 64;
+}
+
+namespace detail {
+
+inline void check_mask_size(std::size_t n, std::span<std::uint64_t> mask)
+{
+    if (mask.size() < mask_words(n))
+    {
+        throw std::length_error("Mask span is too small for the number of values");
+    }
+}
+
+/// Applies pred to every element writing the packed result
+template <typename Predicate>
+inline std::size_t scalar_mask(std::span<const decimal32> values, std::span<std::uint64_t> mask, Predicate pred)
+{
+    std::size_t count {};
+
+    for (std::size_t word {}; word < mask_words(values.size()); ++word)
+    {
+        const std::size_t first {word * 64};
+        const std::size_t last {first + 64 < values.size() ? first + 64 : values.size()};
+
+        std::uint64_t bits {};
+        for (std::size_t i {first}; i < last; ++i)
+        {
+            bits |= static_cast<std::uint64_t>(pred(values[i])) << (i - first);
+        }
+
+        mask[word] = bits;
+        count += static_cast<std::size_t>(std::popcount(bits));
+    }
+
+    return count;
+}
+
+[[nodiscard]] constexpr bool compare(decimal32 x, compare_op op, decimal32 threshold) noexcept
+{
+    switch (op)
+    {
+        case compare_op::less:
+            return x < threshold;
+        case compare_op::less_equal:
+            return x <= threshold;
+        case compare_op::greater:
+            return x > threshold;
+        case compare_op::greater_equal:
+            return x >= threshold;
+        case compare_op::equal:
+            return x == threshold;
+        case compare_op::not_equal:
+            return x != threshold;
+    }
+
+    return false;
+}
+
+inline std::size_t compare_mask_scalar(std::span<const decimal32> values, compare_op op, decimal32 threshold,
+                                       std::span<std::uint64_t> mask)
+{
+    return scalar_mask(values, mask, [op, threshold](decimal32 x) { return compare(x, op, threshold); });
+}
+
+inline std::size_t between_mask_scalar(std::span<const decimal32> values, decimal32 lo, decimal32 hi,
+                                       std::span<std::uint64_t> mask)
+{
+    return scalar_mask(values, mask, [lo, hi](decimal32 x) { return lo <= x && x <= hi; });
+}
+
+inline std::size_t isnan_mask_scalar(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    return scalar_mask(values, mask, [](decimal32 x) { return isnan(x); });
+}
+
+inline std::size_t signbit_mask_scalar(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    return scalar_mask(values, mask, [](decimal32 x) { return static_cast<bool>(x.sign()); });
+}
+
+#ifdef BOOST_DECIMAL_FILTER_AVX2
+
+static_assert(sizeof(decimal32) == sizeof(std::uint32_t), "The SIMD kernels require a packed 32-bit layout");
+
+/// Eight ordering keys plus lane masks of the NaN and negative elements
+struct avx2_keys
+{
+    __m256i key;
+    __m256i nan;
+    __m256i sign;
+};
+
+inline avx2_keys avx2_ordering_keys(const decimal32* ptr) noexcept
+{
+    const __m256i bits {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+
+    const __m256i mantissa {_mm256_and_si256(bits, _mm256_set1_epi32(0x00FFFFFF))};
+
+    // The 7-bit two's complement exponent plus 64 is the same field with its top bit flipped
+    const __m256i biased_exponent {_mm256_xor_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x7F000000)),
+                                                    _mm256_set1_epi32(0x40000000))};
+
+    __m256i magnitude {_mm256_or_si256(biased_exponent, mantissa)};
+
+    const __m256i is_zero {_mm256_cmpeq_epi32(mantissa, _mm256_setzero_si256())};
+    const __m256i is_special {_mm256_cmpgt_epi32(mantissa, _mm256_set1_epi32(BOOST_DECIMAL32_MAN_MAX))};
+
+    magnitude = _mm256_andnot_si256(is_zero, magnitude);
+    magnitude = _mm256_blendv_epi8(magnitude, _mm256_set1_epi32(INT32_MAX), is_special);
+
+    // Conditional negation: (m ^ s) - s with s all ones for negative elements
+    const __m256i sign {_mm256_srai_epi32(bits, 31)};
+    const __m256i key {_mm256_sub_epi32(_mm256_xor_si256(magnitude, sign), sign)};
+
+    const __m256i nan {_mm256_or_si256(_mm256_cmpeq_epi32(mantissa, _mm256_set1_epi32(BOOST_DECIMAL32_QUIET_NAN)),
+                                       _mm256_cmpeq_epi32(mantissa, _mm256_set1_epi32(BOOST_DECIMAL32_SIGNALING_NAN)))};
+
+    return {key, nan, sign};
+}
+
+inline std::uint64_t avx2_lane_bits(__m256i lanes) noexcept
+{
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+}
+
+/// Runs kernel over each block of eight, leaving any tail to the scalar predicate
+template <typename Kernel, typename Predicate>
+inline std::size_t avx2_mask(std::span<const decimal32> values, std::span<std::uint64_t> mask,
+                             Kernel kernel, Predicate pred)
+{
+    std::size_t count {};
+
+    for (std::size_t word {}; word < mask_words(values.size()); ++word)
+    {
+        const std::size_t first {word * 64};
+        const std::size_t last {first + 64 < values.size() ? first + 64 : values.size()};
+
+        std::uint64_t bits {};
+        std::size_t i {first};
+
+        for (; i + 8 <= last; i += 8)
+        {
+            bits |= avx2_lane_bits(kernel(avx2_ordering_keys(values.data() + i))) << (i - first);
+        }
+
+        for (; i < last; ++i)
+        {
+            bits |= static_cast<std::uint64_t>(pred(values[i])) << (i - first);
+        }
+
+        mask[word] = bits;
+        count += static_cast<std::size_t>(std::popcount(bits));
+    }
+
+    return count;
+}
+
+inline std::size_t compare_mask_avx2(std::span<const decimal32> values, compare_op op, decimal32 threshold,
+                                     std::span<std::uint64_t> mask)
+{
+    // Ordered comparisons against NaN are always false and inequality always true
+    if (isnan(threshold))
+    {
+        const bool result {op == compare_op::not_equal};
+        return scalar_mask(values, mask, [result](decimal32) { return result; });
+    }
+
+    const __m256i t {_mm256_set1_epi32(ordering_key(threshold))};
+    const auto pred {[op, threshold](decimal32 x) { return compare(x, op, threshold); }};
+
+    switch (op)
+    {
+        case compare_op::less:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_andnot_si256(k.nan, _mm256_cmpgt_epi32(t, k.key)); }, pred);
+        case compare_op::less_equal:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_andnot_si256(_mm256_or_si256(k.nan, _mm256_cmpgt_epi32(k.key, t)), _mm256_set1_epi32(-1)); }, pred);
+        case compare_op::greater:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_andnot_si256(k.nan, _mm256_cmpgt_epi32(k.key, t)); }, pred);
+        case compare_op::greater_equal:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_andnot_si256(_mm256_or_si256(k.nan, _mm256_cmpgt_epi32(t, k.key)), _mm256_set1_epi32(-1)); }, pred);
+        case compare_op::equal:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_andnot_si256(k.nan, _mm256_cmpeq_epi32(k.key, t)); }, pred);
+        case compare_op::not_equal:
+            return avx2_mask(values, mask, [t](avx2_keys k) { return _mm256_or_si256(k.nan, _mm256_xor_si256(_mm256_cmpeq_epi32(k.key, t), _mm256_set1_epi32(-1))); }, pred);
+    }
+
+    return compare_mask_scalar(values, op, threshold, mask);
+}
+
+inline std::size_t between_mask_avx2(std::span<const decimal32> values, decimal32 lo, decimal32 hi,
+                                     std::span<std::uint64_t> mask)
+{
+    if (isnan(lo) || isnan(hi))
+    {
+        return scalar_mask(values, mask, [](decimal32) { return false; });
+    }
+
+    const __m256i lo_key {_mm256_set1_epi32(ordering_key(lo))};
+    const __m256i hi_key {_mm256_set1_epi32(ordering_key(hi))};
+
+    return avx2_mask(values, mask, [lo_key, hi_key](avx2_keys k)
+    {
+        const __m256i outside {_mm256_or_si256(_mm256_cmpgt_epi32(lo_key, k.key), _mm256_cmpgt_epi32(k.key, hi_key))};
+        return _mm256_andnot_si256(_mm256_or_si256(k.nan, outside), _mm256_set1_epi32(-1));
+    }, [lo, hi](decimal32 x) { return lo <= x && x <= hi; });
+}
+
+inline std::size_t isnan_mask_avx2(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    return avx2_mask(values, mask, [](avx2_keys k) { return k.nan; }, [](decimal32 x) { return isnan(x); });
+}
+
+inline std::size_t signbit_mask_avx2(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    return avx2_mask(values, mask, [](avx2_keys k) { return k.sign; },
+                     [](decimal32 x) { return static_cast<bool>(x.sign()); });
+}
+
+#endif // BOOST_DECIMAL_FILTER_AVX2
+
+} // Namespace detail
+
+/// Selects the elements x for which (x op threshold) holds. NaN satisfies only not_equal
+inline std::size_t compare_mask(std::span<const decimal32> values, compare_op op, decimal32 threshold,
+                                std::span<std::uint64_t> mask)
+{
+    detail::check_mask_size(values.size(), mask);
+
+    #ifdef BOOST_DECIMAL_FILTER_AVX2
+    return detail::compare_mask_avx2(values, op, threshold, mask);
+    #else
+    return detail::compare_mask_scalar(values, op, threshold, mask);
+    #endif
+}
+
+/// Selects the elements in the closed range [lo, hi]
+inline std::size_t between_mask(std::span<const decimal32> values, decimal32 lo, decimal32 hi,
+                                std::span<std::uint64_t> mask)
+{
+    detail::check_mask_size(values.size(), mask);
+
+    #ifdef BOOST_DECIMAL_FILTER_AVX2
+    return detail::between_mask_avx2(values, lo, hi, mask);
+    #else
+    return detail::between_mask_scalar(values, lo, hi, mask);
+    #endif
+}
+
+/// Selects the quiet and signaling NaNs
+inline std::size_t isnan_mask(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    detail::check_mask_size(values.size(), mask);
+
+    #ifdef BOOST_DECIMAL_FILTER_AVX2
+    return detail::isnan_mask_avx2(values, mask);
+    #else
+    return detail::isnan_mask_scalar(values, mask);
+    #endif
+}
+
+/// Selects the elements with the sign bit set, including negative zero and NaN
+inline std::size_t signbit_mask(std::span<const decimal32> values, std::span<std::uint64_t> mask)
+{
+    detail::check_mask_size(values.size(), mask);
+
+    #ifdef BOOST_DECIMAL_FILTER_AVX2
+    return detail::signbit_mask_avx2(values, mask);
+    #else
+    return detail::signbit_mask_scalar(values, mask);
+    #endif
+}
+
+/// Writes the positions of the set bits of the first n bits of mask in ascending order
+/// and returns how many were written. indices must have room for every set bit
+inline std::size_t mask_to_indices(std::span<const std::uint64_t> mask, std::size_t n, std::span<std::uint32_t> indices)
+{
+    if (mask.size() < mask_words(n))
+    {
+        throw std::length_error("Mask span is too small for the number of values");
+    }
+
+    std::size_t count {};
+
+    for (std::size_t word {}; word < mask_words(n); ++word)
+    {
+        std::uint64_t bits {mask[word]};
+        if (word == n / 64)
+        {
+            bits &= (UINT64_C(1) << (n % 64)) - 1;
+        }
+
+        const auto needed {static_cast<std::size_t>(std::popcount(bits))};
+        if (indices.size() - count < needed)
+        {
+            throw std::length_error("Index span is too small for the number of selected values");
+        }
+
+        for (; bits != 0; bits &= bits - 1)
+        {
+            indices[count++] = static_cast<std::uint32_t>(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+        }
+    }
+
+    return count;
+}
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_FILTER_HPP
@@ -0,0 +1,370 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Fixed-point decimal with a compile-time number of fractional digits.
+//  The value is stored as an integer count of units of 10^-Scale so addition and
+//  subtraction are plain integer operations, and multiplication and division only
+//  need to rescale by a compile-time power of ten.
+
+#ifndef BOOST_DECIMAL_FIXED_DECIMAL_HPP
+#define BOOST_DECIMAL_FIXED_DECIMAL_HPP
+
+#include <cstdint>
+#include <concepts>
+#include <compare>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "decimal32.hpp"
+#include "detail/power_tables.hpp"
+#include "detail/rounding.hpp"
+#include "detail/uint128.hpp"
+
+namespace boost::decimal {
+
+/// Decimal number with Scale digits after the decimal point stored in a signed integer Rep.
+/// Unlike decimal32 {coeff, expon}, which places the leading digit of coeff at 10^expon,
+/// from_coefficient(coeff, expon) is the value coeff * 10^expon, e.g. decimal32 {1234, 1} is
+/// 12.34 while fixed_decimal<2>::from_coefficient(1234, 1) is 12340.00
+template <int Scale, std::signed_integral Rep = std::int64_t>
+class fixed_decimal final
+{
+public:
+    using rep_type = Rep;
+    using unsigned_rep_type = std::make_unsigned_t<Rep>;
+
+    static constexpr int scale {Scale};
+
+    static_assert(Scale >= 0 && Scale <= std::numeric_limits<Rep>::digits10,
+                  "Scale must be non-negative and representable in Rep");
+
+    /// 10^Scale i.e. the raw value of 1
+    static constexpr Rep scale_factor {static_cast<Rep>(detail::powers_of_10[Scale])};
+
+private:
+    /// Reciprocal of 10^Scale so that multiplication rescales without a hardware divide
+    static constexpr detail::uint128_divisor scale_divisor {detail::make_uint128_divisor(detail::powers_of_10[Scale])};
+
+    Rep value_;
+
+    struct raw_tag {};
+    constexpr fixed_decimal(raw_tag, Rep raw) noexcept : value_ {raw} {}
+
+    [[nodiscard]] static constexpr unsigned_rep_type unsigned_abs(Rep x) noexcept;
+    [[nodiscard]] static constexpr Rep from_magnitude(bool sign, std::uint64_t mag);
+
+    /// num / den rounded half to even, dividing by divisor which is den itself or its precomputed reciprocal
+    template <typename Divisor>
+    [[nodiscard]] static constexpr std::uint64_t div_round_half_even(detail::uint128 num, std::uint64_t den, const Divisor& divisor);
+
+public:
+    // Rule of 5
+    fixed_decimal() = default;
+    fixed_decimal(const fixed_decimal&) = default;
+    fixed_decimal(fixed_decimal&&) noexcept = default;
+    fixed_decimal& operator=(const fixed_decimal&) = default;
+    fixed_decimal& operator=(fixed_decimal&&) = default;
+    ~fixed_decimal() = default;
+
+    /// Construct from a whole number. Throws std::overflow_error if the value can not be represented
+    explicit constexpr fixed_decimal(std::integral auto whole);
+
+    /// coeff * 10^expon rounded half to even to Scale digits.
+    /// Throws std::overflow_error if the value can not be represented
+    [[nodiscard]] static constexpr fixed_decimal from_coefficient(std::integral auto coeff, int expon);
+
+    /// Exact when the value has at most Scale fractional digits, otherwise rounded half to even.
+    /// Throws std::domain_error for infinity and NaN, and std::overflow_error if the value does not fit
+    explicit constexpr fixed_decimal(decimal32 val);
+
+    /// Construct directly from the underlying count of 10^-Scale units
+    [[nodiscard]] static constexpr fixed_decimal from_raw(Rep raw) noexcept { return fixed_decimal {raw_tag {}, raw}; }
+
+    /// Conversion to decimal32. Exact when the value has at most 7 significant digits
+    [[nodiscard]] constexpr decimal32 to_decimal32() const noexcept;
+    explicit constexpr operator decimal32() const noexcept { return this->to_decimal32(); }
+
+    /// Non-conforming conversion to string e.g. "-12.50" for fixed_decimal<2>
+    [[nodiscard]] inline std::string to_string() const;
+
+    /// Getter to allow access to the underlying integer
+    [[nodiscard]] constexpr Rep raw() const noexcept { return value_; }
+
+    // Unary arithmetic operators
+    [[nodiscard]] constexpr fixed_decimal operator+() const noexcept;
+    [[nodiscard]] constexpr fixed_decimal operator-() const;
+
+    // Binary arithmetic operators. All throw std::overflow_error if the result can not be represented
+    [[nodiscard]] constexpr fixed_decimal operator+(fixed_decimal rhs) const;
+    [[nodiscard]] constexpr fixed_decimal operator-(fixed_decimal rhs) const;
+    [[nodiscard]] constexpr fixed_decimal operator*(fixed_decimal rhs) const;
+    [[nodiscard]] constexpr fixed_decimal operator/(fixed_decimal rhs) const;
+
+    constexpr fixed_decimal& operator+=(fixed_decimal rhs);
+    constexpr fixed_decimal& operator-=(fixed_decimal rhs);
+    constexpr fixed_decimal& operator*=(fixed_decimal rhs);
+    constexpr fixed_decimal& operator/=(fixed_decimal rhs);
+
+    // Comparison operators
+    [[nodiscard]] constexpr bool operator==(const fixed_decimal& rhs) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const fixed_decimal& rhs) const noexcept = default;
+};
+
+template <int Scale, std::signed_integral Rep>
+constexpr typename fixed_decimal<Scale, Rep>::unsigned_rep_type fixed_decimal<Scale, Rep>::unsigned_abs(Rep x) noexcept
+{
+    // Negate in the unsigned domain so that the minimum value of Rep does not overflow
+    return x < 0 ? static_cast<unsigned_rep_type>(unsigned_rep_type(0) - static_cast<unsigned_rep_type>(x)) :
+                   static_cast<unsigned_rep_type>(x);
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr Rep fixed_decimal<Scale, Rep>::from_magnitude(bool sign, std::uint64_t mag)
+{
+    constexpr auto max_positive {static_cast<std::uint64_t>((std::numeric_limits<Rep>::max)())};
+
+    if (mag > max_positive + (sign ? 1U : 0U))
+    {
+        throw std::overflow_error("Result exceeds the range of the fixed_decimal type");
+    }
+
+    if (!sign || mag == 0)
+    {
+        return static_cast<Rep>(mag);
+    }
+
+    return static_cast<Rep>(-static_cast<Rep>(mag - 1U) - 1);
+}
+
+template <int Scale, std::signed_integral Rep>
+template <typename Divisor>
+constexpr std::uint64_t fixed_decimal<Scale, Rep>::div_round_half_even(detail::uint128 num, std::uint64_t den, const Divisor& divisor)
+{
+    // A quotient of 2^64 or more can not be the magnitude of any Rep
+    if (num.high >= den)
+    {
+        throw std::overflow_error("Result exceeds the range of the fixed_decimal type");
+    }
+
+    std::uint64_t rem {};
+    const std::uint64_t quot {detail::udiv128(num, divisor, rem)};
+    const int rem_vs_half {detail::compare_to_half(rem, den)};
+
+    if (rem_vs_half > 0 || (rem_vs_half == 0 && (quot % 2) != 0))
+    {
+        // Saturate instead of wrapping to zero; from_magnitude rejects the result either way
+        return quot == (std::numeric_limits<std::uint64_t>::max)() ? quot : quot + 1;
+    }
+
+    return quot;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>::fixed_decimal(std::integral auto whole)
+{
+    if (std::cmp_greater(whole, (std::numeric_limits<Rep>::max)() / scale_factor) ||
+        std::cmp_less(whole, (std::numeric_limits<Rep>::min)() / scale_factor))
+    {
+        throw std::overflow_error("Integer exceeds the range of the fixed_decimal type");
+    }
+
+    value_ = static_cast<Rep>(static_cast<Rep>(whole) * scale_factor);
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::from_coefficient(std::integral auto coeff, int expon)
+{
+    const bool sign {coeff < 0};
+    std::uint64_t mag {sign ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(coeff) :
+                              static_cast<std::uint64_t>(coeff)};
+
+    const int shift {expon + Scale};
+
+    if (mag == 0)
+    {
+        return from_raw(0);
+    }
+
+    if (shift >= 0)
+    {
+        if (shift > static_cast<int>(detail::max_power_of_10) ||
+            mag > (std::numeric_limits<std::uint64_t>::max)() / detail::pow10(shift))
+        {
+            throw std::overflow_error("Value exceeds the range of the fixed_decimal type");
+        }
+
+        mag *= detail::pow10(shift);
+    }
+    else if (-shift <= static_cast<int>(detail::max_power_of_10))
+    {
+        mag = detail::div_round_half_even(mag, detail::pow10(-shift));
+    }
+    else
+    {
+        mag = 0;
+    }
+
+    return from_raw(from_magnitude(sign, mag));
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>::fixed_decimal(decimal32 val)
+{
+    if (val.mantissa() > BOOST_DECIMAL32_MAN_MAX)
+    {
+        throw std::domain_error("Can not convert infinity or NaN to fixed_decimal");
+    }
+
+    // decimal32 holds mantissa * 10^(exponent - precision + 1)
+    *this = from_coefficient(static_cast<std::int64_t>(val.sign() ? -static_cast<std::int64_t>(val.mantissa()) :
+                                                                      static_cast<std::int64_t>(val.mantissa())),
+                             val.exponent() - BOOST_DECIMAL32_PRECISION + 1);
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr decimal32 fixed_decimal<Scale, Rep>::to_decimal32() const noexcept
+{
+    return detail::make_decimal32(value_ < 0, unsigned_abs(value_), -Scale);
+}
+
+template <int Scale, std::signed_integral Rep>
+std::string fixed_decimal<Scale, Rep>::to_string() const
+{
+    std::string result {std::to_string(unsigned_abs(value_))};
+
+    if constexpr (Scale > 0)
+    {
+        if (result.size() <= static_cast<std::size_t>(Scale))
+        {
+            result.insert(0, static_cast<std::size_t>(Scale) + 1 - result.size(), '0');
+        }
+
+        result.insert(result.size() - Scale, ".");
+    }
+
+    if (value_ < 0)
+    {
+        result.insert(0, "-");
+    }
+
+    return result;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator+() const noexcept
+{
+    return *this;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator-() const
+{
+    if (value_ == (std::numeric_limits<Rep>::min)())
+    {
+        throw std::overflow_error("Result exceeds the range of the fixed_decimal type");
+    }
+
+    return from_raw(static_cast<Rep>(-value_));
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator+(fixed_decimal rhs) const
+{
+    if ((rhs.value_ > 0 && value_ > (std::numeric_limits<Rep>::max)() - rhs.value_) ||
+        (rhs.value_ < 0 && value_ < (std::numeric_limits<Rep>::min)() - rhs.value_))
+    {
+        throw std::overflow_error("Result exceeds the range of the fixed_decimal type");
+    }
+
+    return from_raw(static_cast<Rep>(value_ + rhs.value_));
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator-(fixed_decimal rhs) const
+{
+    if ((rhs.value_ < 0 && value_ > (std::numeric_limits<Rep>::max)() + rhs.value_) ||
+        (rhs.value_ > 0 && value_ < (std::numeric_limits<Rep>::min)() + rhs.value_))
+    {
+        throw std::overflow_error("Result exceeds the range of the fixed_decimal type");
+    }
+
+    return from_raw(static_cast<Rep>(value_ - rhs.value_));
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator*(fixed_decimal rhs) const
+{
+    const bool sign {(value_ < 0) != (rhs.value_ < 0)};
+    const auto scale {static_cast<std::uint64_t>(scale_factor)};
+
+    if constexpr (sizeof(Rep) < sizeof(std::uint64_t))
+    {
+        const std::uint64_t product {static_cast<std::uint64_t>(unsigned_abs(value_)) * unsigned_abs(rhs.value_)};
+        return from_raw(from_magnitude(sign, detail::div_round_half_even(product, scale)));
+    }
+    else
+    {
+        const detail::uint128 product {detail::umul128(unsigned_abs(value_), unsigned_abs(rhs.value_))};
+        return from_raw(from_magnitude(sign, div_round_half_even(product, scale, scale_divisor)));
+    }
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep> fixed_decimal<Scale, Rep>::operator/(fixed_decimal rhs) const
+{
+    if (rhs.value_ == 0)
+    {
+        throw std::domain_error("Division of fixed_decimal by zero");
+    }
+
+    const bool sign {(value_ < 0) != (rhs.value_ < 0)};
+    const auto scale {static_cast<std::uint64_t>(scale_factor)};
+    const std::uint64_t den {unsigned_abs(rhs.value_)};
+
+    if constexpr (sizeof(Rep) < sizeof(std::uint64_t))
+    {
+        const std::uint64_t numerator {static_cast<std::uint64_t>(unsigned_abs(value_)) * scale};
+        return from_raw(from_magnitude(sign, detail::div_round_half_even(numerator, den)));
+    }
+    else
+    {
+        const detail::uint128 numerator {detail::umul128(unsigned_abs(value_), scale)};
+        return from_raw(from_magnitude(sign, div_round_half_even(numerator, den, den)));
+    }
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>& fixed_decimal<Scale, Rep>::operator+=(fixed_decimal rhs)
+{
+    *this = *this + rhs;
+    return *this;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>& fixed_decimal<Scale, Rep>::operator-=(fixed_decimal rhs)
+{
+    *this = *this - rhs;
+    return *this;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>& fixed_decimal<Scale, Rep>::operator*=(fixed_decimal rhs)
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+template <int Scale, std::signed_integral Rep>
+constexpr fixed_decimal<Scale, Rep>& fixed_decimal<Scale, Rep>::operator/=(fixed_decimal rhs)
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_FIXED_DECIMAL_HPP
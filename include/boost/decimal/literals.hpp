@@ -0,0 +1,172 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  User defined literals for the decimal types e.g. 1.25_DF
+//  The literal is parsed by a consteval operator so the bit pattern is always
+//  produced at compile time, and a malformed literal or one whose non-zero value
+//  overflows or underflows decimal32 is a compile time error.
+
+#ifndef BOOST_DECIMAL_LITERALS_HPP
+#define BOOST_DECIMAL_LITERALS_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include "decimal32.hpp"
+#include "detail/power_tables.hpp"
+
+namespace boost::decimal {
+
+namespace detail {
+
+[[nodiscard]] constexpr bool is_digit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+/// Digit separators e.g. 1'000.25 reach a raw literal operator unchanged
+[[nodiscard]] constexpr bool is_digit_or_separator(char c) noexcept
+{
+    return is_digit(c) || c == '\'';
+}
+
+/// Parses a decimal floating literal of the form digits[.digits][(e|E)[+|-]digits].
+/// Digits beyond what fits in 64 bits only contribute to correct rounding
+[[nodiscard]] constexpr decimal32 parse_decimal32_literal(const char* str)
+{
+    constexpr int max_significand_digits {static_cast<int>(max_power_of_10)};
+
+    std::uint64_t significand {};
+    int significand_digits {};
+    int exp10 {};
+    bool any_digits {false};
+    bool dropped_nonzero {false};
+
+    const auto accumulate = [&](char c, bool fractional)
+    {
+        if (c == '\'')
+        {
+            return;
+        }
+
+        any_digits = true;
+
+        // Leading zeros do not count towards precision
+        if (significand == 0 && c == '0')
+        {
+            exp10 -= fractional ? 1 : 0;
+            return;
+        }
+
+        if (significand_digits < max_significand_digits)
+        {
+            significand = significand * 10 + static_cast<std::uint64_t>(c - '0');
+            ++significand_digits;
+            exp10 -= fractional ? 1 : 0;
+        }
+        else
+        {
+            dropped_nonzero = dropped_nonzero || c != '0';
+            exp10 += fractional ? 0 : 1;
+        }
+    };
+
+    for (; is_digit_or_separator(*str); ++str)
+    {
+        accumulate(*str, false);
+    }
+
+    if (*str == '.')
+    {
+        for (++str; is_digit_or_separator(*str); ++str)
+        {
+            accumulate(*str, true);
+        }
+    }
+
+    if (!any_digits)
+    {
+        throw std::invalid_argument("Decimal literal requires at least one digit");
+    }
+
+    if (*str == 'e' || *str == 'E')
+    {
+        ++str;
+
+        const bool negative_exponent {*str == '-'};
+        if (*str == '-' || *str == '+')
+        {
+            ++str;
+        }
+
+        if (!is_digit(*str))
+        {
+            throw std::invalid_argument("Decimal literal exponent requires at least one digit");
+        }
+
+        int literal_exponent {};
+        for (; is_digit_or_separator(*str); ++str)
+        {
+            if (*str == '\'')
+            {
+                continue;
+            }
+
+            // Anything this large is already far outside the range of every decimal type
+            if (literal_exponent < 100000)
+            {
+                literal_exponent = literal_exponent * 10 + (*str - '0');
+            }
+        }
+
+        exp10 += negative_exponent ? -literal_exponent : literal_exponent;
+    }
+
+    if (*str != '\0')
+    {
+        throw std::invalid_argument("Invalid character in decimal literal");
+    }
+
+    // Dropped digits lie strictly between significand and significand + 1, so bumping a
+    // trailing zero keeps the value off any rounding boundary without changing the result
+    if (dropped_nonzero && significand % 10 == 0)
+    {
+        ++significand;
+    }
+
+    const auto result {make_decimal32(false, significand, exp10)};
+
+    if (result.mantissa() > BOOST_DECIMAL32_MAN_MAX)
+    {
+        throw std::overflow_error("Decimal literal exceeds the range of decimal32");
+    }
+
+    if (result.mantissa() == 0 && significand != 0)
+    {
+        throw std::underflow_error("Non-zero decimal literal is below the range of decimal32");
+    }
+
+    return result;
+}
+
+} // Namespace detail
+
+inline namespace literals {
+
+/// 1.25_DF and 1.25_df produce a decimal32 following the DF suffix of ISO/IEC TR 24733
+consteval decimal32 operator""_DF(const char* str)
+{
+    return detail::parse_decimal32_literal(str);
+}
+
+consteval decimal32 operator""_df(const char* str)
+{
+    return detail::parse_decimal32_literal(str);
+}
+
+} // Namespace literals
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_LITERALS_HPP
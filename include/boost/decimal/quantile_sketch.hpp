@@ -0,0 +1,413 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Fixed memory streaming histogram of decimal32 values for quantile estimation.
+//
+//  Each value is counted in the bucket given by its sign, its exponent and the leading
+//  Digits digits of its mantissa, so insertion is a constant time index computation and
+//  bucket boundaries fall on decimal values. Reported quantiles are bucket midpoints,
+//  which are within a relative error of 1 / (2 * 10^(Digits - 1)) of a value of that rank.
+//
+//  The buckets cover exponents [MinExponent, MaxExponent], by default values from 1e-8 up to
+//  1e9, and all counters are stored inline. Values outside the range are counted per sign
+//  below or above it without their digits, see quantile() for what such ranks report and
+//  out_of_range_count() to detect them. The number of counters is capped so that a sketch
+//  stays small enough for a thread stack, see relative_accuracy() for the trade off.
+//  Sketches are not synchronized. Keep one per thread and merge them with operator+=.
+
+#ifndef BOOST_DECIMAL_QUANTILE_SKETCH_HPP
+#define BOOST_DECIMAL_QUANTILE_SKETCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include "decimal32.hpp"
+#include "detail/math.hpp"
+#include "detail/power_tables.hpp"
+#include "detail/uint128.hpp"
+
+namespace boost::decimal {
+
+namespace detail {
+
+/// Upper bound on the bucket counters of a quantile_sketch i.e. 256 KiB of storage
+inline constexpr std::size_t quantile_sketch_max_buckets {32768};
+
+} // Namespace detail
+
+template <int Digits, int MinExponent = -8, int MaxExponent = 8>
+class quantile_sketch final
+{
+public:
+    static_assert(Digits >= 1 && Digits <= 4, "Digits must be in [1, 4]");
+    static_assert(MinExponent >= BOOST_DECIMAL32_EMIN && MaxExponent <= BOOST_DECIMAL32_EMAX && MinExponent <= MaxExponent,
+                  "The exponent range must lie within that of decimal32");
+
+    static constexpr int digits {Digits};
+
+    /// Leading digit combinations per exponent e.g. 90 for two digits (10 through 99)
+    static constexpr std::size_t buckets_per_exponent {9 * detail::powers_of_10[Digits - 1]};
+    static constexpr std::size_t exponent_rows {static_cast<std::size_t>(MaxExponent - MinExponent + 1)};
+    static constexpr std::size_t buckets_per_sign {buckets_per_exponent * exponent_rows};
+
+    static_assert(2 * buckets_per_sign <= detail::quantile_sketch_max_buckets,
+                  "Too many buckets, narrow the exponent range or reduce Digits");
+
+    /// Bound on the relative error of a reported quantile for values inside the exponent range.
+    /// Each extra digit divides it by ten and multiplies the footprint, about
+    /// 16 * exponent_rows * (buckets_per_exponent + 1) bytes, by ten. Within the bucket cap the
+    /// default range allows up to three digits (245 KB), and four digits need a single exponent
+    [[nodiscard]] static constexpr decimal32 relative_accuracy() noexcept { return detail::make_decimal32(false, 5, -Digits); }
+
+private:
+    std::array<std::uint64_t, buckets_per_sign> positive_ {};
+    std::array<std::uint64_t, buckets_per_sign> negative_ {};
+
+    // Per exponent totals so quantile() only scans the buckets of a single row
+    std::array<std::uint64_t, exponent_rows> positive_rows_ {};
+    std::array<std::uint64_t, exponent_rows> negative_rows_ {};
+    std::uint64_t zero_ {};
+
+    // Finite non-zero values with an exponent below MinExponent or above MaxExponent, and the
+    // largest magnitude above the range of each sign
+    std::uint64_t positive_below_ {};
+    std::uint64_t negative_below_ {};
+    std::uint64_t positive_above_ {};
+    std::uint64_t negative_above_ {};
+    decimal32 highest_above_ {};
+    decimal32 lowest_above_ {};
+
+    std::uint64_t positive_infinity_ {};
+    std::uint64_t negative_infinity_ {};
+    std::uint64_t count_ {};
+    std::uint64_t nan_count_ {};
+    decimal32 min_ {};
+    decimal32 max_ {};
+
+    [[nodiscard]] static constexpr std::size_t bucket_index(decimal32 x) noexcept;
+    [[nodiscard]] static constexpr decimal32 bucket_midpoint(bool sign, std::size_t index) noexcept;
+
+    /// Index of the bucket at which the running count seen reaches rank, walking buckets in
+    /// ascending or descending order. Returns buckets_per_sign with seen advanced past every
+    /// bucket if rank is not reached
+    [[nodiscard]] static constexpr std::size_t find_bucket(const std::array<std::uint64_t, buckets_per_sign>& counts,
+                                                           const std::array<std::uint64_t, exponent_rows>& rows,
+                                                           std::uint64_t rank, std::uint64_t& seen, bool descending) noexcept;
+
+    [[nodiscard]] constexpr decimal32 clamp_to_observed(decimal32 x) const noexcept;
+
+public:
+    /// Counts x. NaN is only recorded in nan_count
+    constexpr void insert(decimal32 x) noexcept;
+
+    constexpr void insert(std::span<const decimal32> values) noexcept;
+
+    /// Number of non-NaN values inserted
+    [[nodiscard]] constexpr std::uint64_t count() const noexcept { return count_; }
+    [[nodiscard]] constexpr std::uint64_t nan_count() const noexcept { return nan_count_; }
+
+    /// Number of finite non-zero values outside the exponent range, whose ranks are not
+    /// covered by relative_accuracy()
+    [[nodiscard]] constexpr std::uint64_t out_of_range_count() const noexcept
+    {
+        return positive_below_ + negative_below_ + positive_above_ + negative_above_;
+    }
+
+    /// Exact extremes of the inserted values, NaN when empty
+    [[nodiscard]] constexpr decimal32 min() const noexcept;
+    [[nodiscard]] constexpr decimal32 max() const noexcept;
+
+    /// Estimate of the value of rank ceil(q * count()) for q in [0, 1].
+    /// NaN when empty or when q is outside [0, 1]. A rank among the values above the exponent
+    /// range reports the largest finite magnitude inserted with that sign, and a rank among the
+    /// values below it reports +/-10^MinExponent, an absolute error below 10^MinExponent
+    [[nodiscard]] constexpr decimal32 quantile(decimal32 q) const noexcept;
+
+    /// Merges the counts of rhs into this sketch
+    constexpr quantile_sketch& operator+=(const quantile_sketch& rhs) noexcept;
+
+    constexpr void clear() noexcept;
+};
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr std::size_t quantile_sketch<Digits, MinExponent, MaxExponent>::bucket_index(decimal32 x) noexcept
+{
+    const int row {x.exponent()};
+    const std::uint32_t leading {detail::div_pow10_24bit(x.mantissa(), BOOST_DECIMAL32_PRECISION - Digits)};
+
+    return static_cast<std::size_t>(row - MinExponent) * buckets_per_exponent +
+           (leading - static_cast<std::size_t>(detail::powers_of_10[Digits - 1]));
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr decimal32 quantile_sketch<Digits, MinExponent, MaxExponent>::bucket_midpoint(bool sign, std::size_t index) noexcept
+{
+    const int row {static_cast<int>(index / buckets_per_exponent) + MinExponent};
+    const std::uint64_t leading {index % buckets_per_exponent + detail::powers_of_10[Digits - 1]};
+
+    // The bucket spans [leading, leading + 1) * 10^(row - Digits + 1)
+    return detail::make_decimal32(sign, 10 * leading + 5, row - Digits);
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr std::size_t quantile_sketch<Digits, MinExponent, MaxExponent>::find_bucket(
+    const std::array<std::uint64_t, buckets_per_sign>& counts, const std::array<std::uint64_t, exponent_rows>& rows,
+    std::uint64_t rank, std::uint64_t& seen, bool descending) noexcept
+{
+    for (std::size_t r {}; r < exponent_rows; ++r)
+    {
+        const std::size_t row {descending ? exponent_rows - 1 - r : r};
+
+        // Skip whole rows using their totals
+        if (seen + rows[row] < rank)
+        {
+            seen += rows[row];
+            continue;
+        }
+
+        for (std::size_t b {}; b < buckets_per_exponent; ++b)
+        {
+            const std::size_t index {row * buckets_per_exponent + (descending ? buckets_per_exponent - 1 - b : b)};
+            seen += counts[index];
+            if (seen >= rank)
+            {
+                return index;
+            }
+        }
+    }
+
+    return buckets_per_sign;
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr decimal32 quantile_sketch<Digits, MinExponent, MaxExponent>::clamp_to_observed(decimal32 x) const noexcept
+{
+    return x < min_ ? min_ : (x > max_ ? max_ : x);
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr void quantile_sketch<Digits, MinExponent, MaxExponent>::insert(decimal32 x) noexcept
+{
+    if (isnan(x))
+    {
+        ++nan_count_;
+        return;
+    }
+
+    if (count_ == 0 || x < min_)
+    {
+        min_ = x;
+    }
+
+    if (count_ == 0 || x > max_)
+    {
+        max_ = x;
+    }
+
+    ++count_;
+
+    if (x.mantissa() == 0)
+    {
+        ++zero_;
+    }
+    else if (isinf(x))
+    {
+        ++(x.sign() ? negative_infinity_ : positive_infinity_);
+    }
+    else if (x.exponent() < MinExponent)
+    {
+        ++(x.sign() ? negative_below_ : positive_below_);
+    }
+    else if (x.exponent() > MaxExponent)
+    {
+        if (x.sign())
+        {
+            lowest_above_ = negative_above_ == 0 || x < lowest_above_ ? x : lowest_above_;
+            ++negative_above_;
+        }
+        else
+        {
+            highest_above_ = positive_above_ == 0 || x > highest_above_ ? x : highest_above_;
+            ++positive_above_;
+        }
+    }
+    else
+    {
+        const std::size_t index {bucket_index(x)};
+        ++(x.sign() ? negative_ : positive_)[index];
+        ++(x.sign() ? negative_rows_ : positive_rows_)[index / buckets_per_exponent];
+    }
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr void quantile_sketch<Digits, MinExponent, MaxExponent>::insert(std::span<const decimal32> values) noexcept
+{
+    for (const auto x : values)
+    {
+        this->insert(x);
+    }
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr decimal32 quantile_sketch<Digits, MinExponent, MaxExponent>::min() const noexcept
+{
+    return count_ == 0 ? std::numeric_limits<decimal32>::quiet_NaN() : min_;
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr decimal32 quantile_sketch<Digits, MinExponent, MaxExponent>::max() const noexcept
+{
+    return count_ == 0 ? std::numeric_limits<decimal32>::quiet_NaN() : max_;
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr decimal32 quantile_sketch<Digits, MinExponent, MaxExponent>::quantile(decimal32 q) const noexcept
+{
+    if (count_ == 0 || isnan(q) || q < decimal32 {} || q > decimal32 {1, 0})
+    {
+        return std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    // rank = ceil(q * count) computed exactly from the integer significand of q
+    detail::uint128 scaled {detail::umul128(q.mantissa(), count_)};
+    bool inexact {false};
+
+    for (int shift {BOOST_DECIMAL32_PRECISION - 1 - q.exponent()}; shift > 0;)
+    {
+        const int step {shift < static_cast<int>(detail::max_power_of_10) ? shift : static_cast<int>(detail::max_power_of_10)};
+        std::uint64_t rem {};
+        scaled = detail::udiv128_wide(scaled, detail::pow10(step), rem);
+        inexact = inexact || rem != 0;
+        shift -= step;
+    }
+
+    std::uint64_t rank {scaled.low + (inexact ? 1U : 0U)};
+    rank = rank == 0 ? 1 : rank;
+
+    // Walk the buckets in ascending order of value
+    std::uint64_t seen {negative_infinity_};
+    if (seen >= rank)
+    {
+        return detail::signed_infinity(true);
+    }
+
+    // Negative values ascend in value from the largest magnitude
+    seen += negative_above_;
+    if (seen >= rank)
+    {
+        return lowest_above_;
+    }
+
+    const std::size_t negative_index {find_bucket(negative_, negative_rows_, rank, seen, true)};
+    if (negative_index != buckets_per_sign)
+    {
+        return clamp_to_observed(bucket_midpoint(true, negative_index));
+    }
+
+    seen += negative_below_;
+    if (seen >= rank)
+    {
+        return clamp_to_observed(detail::make_decimal32(true, 1, MinExponent));
+    }
+
+    seen += zero_;
+    if (seen >= rank)
+    {
+        return decimal32 {};
+    }
+
+    seen += positive_below_;
+    if (seen >= rank)
+    {
+        return clamp_to_observed(detail::make_decimal32(false, 1, MinExponent));
+    }
+
+    const std::size_t positive_index {find_bucket(positive_, positive_rows_, rank, seen, false)};
+    if (positive_index != buckets_per_sign)
+    {
+        return clamp_to_observed(bucket_midpoint(false, positive_index));
+    }
+
+    seen += positive_above_;
+    if (seen >= rank)
+    {
+        return highest_above_;
+    }
+
+    return detail::signed_infinity(false);
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr quantile_sketch<Digits, MinExponent, MaxExponent>&
+quantile_sketch<Digits, MinExponent, MaxExponent>::operator+=(const quantile_sketch& rhs) noexcept
+{
+    if (rhs.count_ != 0)
+    {
+        min_ = count_ == 0 || rhs.min_ < min_ ? rhs.min_ : min_;
+        max_ = count_ == 0 || rhs.max_ > max_ ? rhs.max_ : max_;
+    }
+
+    if (rhs.positive_above_ != 0)
+    {
+        highest_above_ = positive_above_ == 0 || rhs.highest_above_ > highest_above_ ? rhs.highest_above_ : highest_above_;
+    }
+
+    if (rhs.negative_above_ != 0)
+    {
+        lowest_above_ = negative_above_ == 0 || rhs.lowest_above_ < lowest_above_ ? rhs.lowest_above_ : lowest_above_;
+    }
+
+    for (std::size_t i {}; i < buckets_per_sign; ++i)
+    {
+        positive_[i] += rhs.positive_[i];
+        negative_[i] += rhs.negative_[i];
+    }
+
+    for (std::size_t i {}; i < exponent_rows; ++i)
+    {
+        positive_rows_[i] += rhs.positive_rows_[i];
+        negative_rows_[i] += rhs.negative_rows_[i];
+    }
+
+    zero_ += rhs.zero_;
+    positive_below_ += rhs.positive_below_;
+    negative_below_ += rhs.negative_below_;
+    positive_above_ += rhs.positive_above_;
+    negative_above_ += rhs.negative_above_;
+    positive_infinity_ += rhs.positive_infinity_;
+    negative_infinity_ += rhs.negative_infinity_;
+    count_ += rhs.count_;
+    nan_count_ += rhs.nan_count_;
+
+    return *this;
+}
+
+template <int Digits, int MinExponent, int MaxExponent>
+constexpr void quantile_sketch<Digits, MinExponent, MaxExponent>::clear() noexcept
+{
+    positive_.fill(0);
+    negative_.fill(0);
+    positive_rows_.fill(0);
+    negative_rows_.fill(0);
+    zero_ = 0;
+    positive_below_ = 0;
+    negative_below_ = 0;
+    positive_above_ = 0;
+    negative_above_ = 0;
+    highest_above_ = decimal32 {};
+    lowest_above_ = decimal32 {};
+    positive_infinity_ = 0;
+    negative_infinity_ = 0;
+    count_ = 0;
+    nan_count_ = 0;
+    min_ = decimal32 {};
+    max_ = decimal32 {};
+}
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_QUANTILE_SKETCH_HPP
@@ -0,0 +1,315 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Quantum operations of IEEE 754-2019 5.3.2 and 5.7.3 plus rounding to an arbitrary increment.
+//
+//  decimal32 always stores a normalized significand, so it does not retain the quantum
+//  of the operation that produced it. Here the quantum exponent of a finite value is the
+//  exponent of its least significant non-zero digit, e.g. 0.05 and 1.25 have quantum
+//  exponent -2 while 1.00 has 0. Zero is taken to have quantum exponent 0.
+//  As in IEEE 754 a result that rounds to zero keeps the sign of the operand.
+
+#ifndef BOOST_DECIMAL_QUANTIZE_HPP
+#define BOOST_DECIMAL_QUANTIZE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include "decimal32.hpp"
+#include "detail/math.hpp"
+#include "detail/power_tables.hpp"
+#include "detail/rounding.hpp"
+
+namespace boost::decimal {
+
+namespace detail {
+
+/// Finite non-zero value as significand * 10^exp10 with the trailing zeros removed
+struct stripped_decimal
+{
+    std::uint32_t significand;
+    int exp10;
+};
+
+[[nodiscard]] constexpr stripped_decimal strip_trailing_zeros(decimal32 x) noexcept
+{
+    std::uint32_t sig {x.mantissa()};
+    int exp10 {x.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+
+    // A normalized significand has at most six trailing zeros, so three fixed steps cover all of them
+    for (const int k : {4, 2, 1})
+    {
+        const std::uint32_t quot {div_pow10_24bit(sig, k)};
+        if (quot * static_cast<std::uint32_t>(pow10(k)) == sig)
+        {
+            sig = quot;
+            exp10 += k;
+        }
+    }
+
+    return {sig, exp10};
+}
+
+[[nodiscard]] constexpr int quantum_exponent(decimal32 x) noexcept
+{
+    return x.mantissa() == 0 ? 0 : strip_trailing_zeros(x).exp10;
+}
+
+/// 10^n mod m for m < 2^26
+[[nodiscard]] constexpr std::uint64_t pow10_mod(int n, std::uint64_t m) noexcept
+{
+    if (n <= static_cast<int>(max_power_of_10))
+    {
+        return pow10(n) % m;
+    }
+
+    std::uint64_t result {1 % m};
+    std::uint64_t base {10 % m};
+
+    for (; n != 0; n >>= 1)
+    {
+        if ((n & 1) != 0)
+        {
+            result = result * base % m;
+        }
+
+        base = base * base % m;
+    }
+
+    return result;
+}
+
+/// Rounds finite x to a multiple of tick.significand * 10^tick.exp10
+[[nodiscard]] constexpr decimal32 round_to_increment_impl(decimal32 x, stripped_decimal tick, rounding_mode mode) noexcept
+{
+    if (!isfinite(x))
+    {
+        return isnan(x) ? x : std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    const std::uint32_t sig {x.mantissa()};
+    const int exp10 {x.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+    const bool negative {static_cast<bool>(x.sign())};
+
+    if (sig == 0)
+    {
+        return x;
+    }
+
+    const std::uint64_t tick_sig {tick.significand};
+
+    if (exp10 >= tick.exp10)
+    {
+        // x / tick = sig * 10^d / tick_sig can be far too wide to form, but the remainder and
+        // the parity of the quotient both follow from sig * 10^d mod 2 * tick_sig
+        const std::uint64_t twice_tick {2 * tick_sig};
+        const std::uint64_t residue {sig % twice_tick * pow10_mod(exp10 - tick.exp10, twice_tick) % twice_tick};
+        const bool quot_is_odd {residue >= tick_sig};
+        const std::uint64_t rem {quot_is_odd ? residue - tick_sig : residue};
+
+        if (rem == 0)
+        {
+            return x;
+        }
+
+        // Move to the neighbouring multiple with a single rounding to decimal32
+        if (round_magnitude_up(mode, negative, quot_is_odd, true, compare_to_half(rem, tick_sig)))
+        {
+            return add_significands(negative, sig, exp10, negative, tick_sig - rem, tick.exp10);
+        }
+
+        // Exact cancellation gives +0 from add_significands but the result keeps the sign of x
+        const decimal32 rounded_down {add_significands(negative, sig, exp10, !negative, rem, tick.exp10)};
+        return rounded_down.mantissa() == 0 ? signed_zero(negative) : rounded_down;
+    }
+
+    // The increment has digits above the least significant digit of x
+    const int shift {tick.exp10 - exp10};
+    std::uint64_t quot {};
+    std::uint64_t rem {sig};
+    int rem_vs_half {-1};
+
+    if (shift <= BOOST_DECIMAL32_PRECISION)
+    {
+        const std::uint64_t divisor {tick_sig * pow10(shift)};
+        quot = sig / divisor;
+        rem = sig - quot * divisor;
+        rem_vs_half = compare_to_half(rem, divisor);
+    }
+
+    if (round_magnitude_up(mode, negative, (quot % 2) != 0, rem != 0, rem_vs_half))
+    {
+        ++quot;
+    }
+
+    return quot == 0 ? signed_zero(negative) : make_decimal32(negative, quot * tick_sig, tick.exp10);
+}
+
+inline void check_output_size(std::size_t n, std::span<decimal32> result)
+{
+    if (result.size() < n)
+    {
+        throw std::length_error("Result span is too small for the number of values");
+    }
+}
+
+} // Namespace detail
+
+/// Rounds x to a multiple of 10^exponent e.g. rescale(1.2345, -2) == 1.23
+[[nodiscard]] constexpr decimal32 rescale(decimal32 x, int exponent,
+                                          rounding_mode mode = rounding_mode::fe_dec_to_nearest) noexcept
+{
+    if (!isfinite(x))
+    {
+        return isnan(x) ? x : std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    const std::uint32_t sig {x.mantissa()};
+    const int exp10 {x.exponent() - (BOOST_DECIMAL32_PRECISION - 1)};
+
+    // Already a multiple of 10^exponent
+    if (sig == 0 || exp10 >= exponent)
+    {
+        return x;
+    }
+
+    const bool negative {static_cast<bool>(x.sign())};
+    std::uint32_t quot {};
+    std::uint32_t rem {sig};
+    int rem_vs_half {-1};
+
+    if (exponent - BOOST_DECIMAL32_PRECISION <= exp10)
+    {
+        const int shift {exponent - exp10};
+        const auto divisor {static_cast<std::uint32_t>(detail::pow10(shift))};
+
+        quot = detail::div_pow10_24bit(sig, shift);
+        rem = sig - quot * divisor;
+        rem_vs_half = detail::compare_to_half(rem, divisor);
+    }
+
+    if (detail::round_magnitude_up(mode, negative, (quot % 2) != 0, rem != 0, rem_vs_half))
+    {
+        ++quot;
+    }
+
+    return quot == 0 ? detail::signed_zero(negative) : detail::make_decimal32(negative, quot, exponent);
+}
+
+/// Rounds x to the quantum of exemplar e.g. quantize(1.2345, 0.01) == 1.23
+[[nodiscard]] constexpr decimal32 quantize(decimal32 x, decimal32 exemplar,
+                                           rounding_mode mode = rounding_mode::fe_dec_to_nearest) noexcept
+{
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (isnan(exemplar))
+    {
+        return exemplar;
+    }
+
+    if (isinf(x) || isinf(exemplar))
+    {
+        return isinf(x) && isinf(exemplar) ? x : std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    return rescale(x, detail::quantum_exponent(exemplar), mode);
+}
+
+/// Whether x and y have the same quantum exponent. Two NaNs or two infinities compare equal
+[[nodiscard]] constexpr bool samequantum(decimal32 x, decimal32 y) noexcept
+{
+    if (isnan(x) || isnan(y))
+    {
+        return isnan(x) && isnan(y);
+    }
+
+    if (isinf(x) || isinf(y))
+    {
+        return isinf(x) && isinf(y);
+    }
+
+    return detail::quantum_exponent(x) == detail::quantum_exponent(y);
+}
+
+/// Rounds x to a multiple of |tick| e.g. round_to_increment(1.13, 0.05) == 1.15.
+/// A zero, infinite or NaN tick gives NaN
+[[nodiscard]] constexpr decimal32 round_to_increment(decimal32 x, decimal32 tick,
+                                                     rounding_mode mode = rounding_mode::fe_dec_to_nearest) noexcept
+{
+    if (isnan(x))
+    {
+        return x;
+    }
+
+    if (!isfinite(tick) || tick.mantissa() == 0)
+    {
+        return isnan(tick) ? tick : std::numeric_limits<decimal32>::quiet_NaN();
+    }
+
+    return detail::round_to_increment_impl(x, detail::strip_trailing_zeros(tick), mode);
+}
+
+// Batch versions writing result[i] for each values[i]. result may alias values.
+// The per call work on the exemplar or tick is done once rather than per element.
+
+inline void rescale(std::span<const decimal32> values, int exponent, std::span<decimal32> result,
+                    rounding_mode mode = rounding_mode::fe_dec_to_nearest)
+{
+    detail::check_output_size(values.size(), result);
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        result[i] = rescale(values[i], exponent, mode);
+    }
+}
+
+inline void quantize(std::span<const decimal32> values, decimal32 exemplar, std::span<decimal32> result,
+                     rounding_mode mode = rounding_mode::fe_dec_to_nearest)
+{
+    detail::check_output_size(values.size(), result);
+
+    if (!isfinite(exemplar))
+    {
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            result[i] = quantize(values[i], exemplar, mode);
+        }
+
+        return;
+    }
+
+    rescale(values, detail::quantum_exponent(exemplar), result, mode);
+}
+
+inline void round_to_increment(std::span<const decimal32> values, decimal32 tick, std::span<decimal32> result,
+                               rounding_mode mode = rounding_mode::fe_dec_to_nearest)
+{
+    detail::check_output_size(values.size(), result);
+
+    if (!isfinite(tick) || tick.mantissa() == 0)
+    {
+        for (std::size_t i {}; i < values.size(); ++i)
+        {
+            result[i] = round_to_increment(values[i], tick, mode);
+        }
+
+        return;
+    }
+
+    const auto increment {detail::strip_trailing_zeros(tick)};
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        result[i] = detail::round_to_increment_impl(values[i], increment, mode);
+    }
+}
+
+} // Namespace boost::decimal
+
+#endif // BOOST_DECIMAL_QUANTIZE_HPP
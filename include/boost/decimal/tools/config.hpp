@@ -8,4 +8,10 @@
 
 #include "is_standalone.hpp"
 
+// Native 128-bit integers are used for widening 64-bit intermediate products.
+// Define BOOST_DECIMAL_DISABLE_INT128 to use the portable fallback instead
+#if defined(__SIZEOF_INT128__) && !defined(BOOST_DECIMAL_HAS_INT128) && !defined(BOOST_DECIMAL_DISABLE_INT128)
+#   define BOOST_DECIMAL_HAS_INT128
+#endif
+
 #endif // BOOST_DECIMAL_TOOLS_CONFIG_HPP
@@ -4,6 +4,8 @@
 //  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #define BOOST_TEST_MODULE constructor_test
+#include <cstdint>
+#include <limits>
 #include <boost/test/included/unit_test.hpp>
 
 #include "../include/boost/decimal/decimal32.hpp"
@@ -15,3 +17,29 @@ BOOST_AUTO_TEST_CASE( int_constructor )
     BOOST_TEST(ten.exponent() == 1);
     BOOST_TEST(!ten.sign());
 }
+
+BOOST_AUTO_TEST_CASE( rounding_constructor )
+{
+    using boost::decimal::decimal32;
+
+    // Digits beyond the precision are rounded half to even, not truncated
+    constexpr decimal32 rounded(12345675, 0);
+    static_assert(rounded.mantissa() == 1234568 && rounded.exponent() == 1);
+
+    constexpr decimal32 tie(12345665, 0);
+    static_assert(tie.mantissa() == 1234566 && tie.exponent() == 1);
+
+    constexpr decimal32 carry(-99999995, 0);
+    static_assert(carry.mantissa() == 1000000 && carry.exponent() == 2 && carry.sign());
+
+    // The minimum value of a signed type is negated without overflow
+    constexpr decimal32 int_min((std::numeric_limits<std::int32_t>::min)(), 0);
+    static_assert(int_min.mantissa() == 2147484 && int_min.exponent() == 3 && int_min.sign());
+
+    // Underflow gives zero and overflow gives infinity
+    const decimal32 tiny(1, -70);
+    BOOST_TEST(tiny.mantissa() == 0);
+
+    const decimal32 huge(1, 70);
+    BOOST_TEST(huge.mantissa() == BOOST_DECIMAL32_INF);
+}
@@ -0,0 +1,139 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/filter.hpp"
+#include "../include/boost/decimal/literals.hpp"
+
+using namespace boost::decimal;
+
+void comparison_operators()
+{
+    const decimal32 nan {std::numeric_limits<decimal32>::quiet_NaN()};
+    const decimal32 inf {std::numeric_limits<decimal32>::infinity()};
+
+    BOOST_TEST(-5_DF < 3_DF);
+    BOOST_TEST(-5_DF < -3_DF);
+    BOOST_TEST(3_DF > -5_DF);
+    BOOST_TEST(0.001_DF > 0_DF);
+    BOOST_TEST(-0.001_DF < 0_DF);
+    BOOST_TEST(1e10_DF > 9.999999e9_DF);
+    BOOST_TEST(-inf < std::numeric_limits<decimal32>::lowest());
+    BOOST_TEST(inf > std::numeric_limits<decimal32>::max());
+    BOOST_TEST(0_DF == -0_DF);
+    BOOST_TEST(2.5_DF >= 2.5_DF);
+    BOOST_TEST(2.5_DF <= 2.5_DF);
+
+    BOOST_TEST(!(nan == nan));
+    BOOST_TEST(nan != nan);
+    BOOST_TEST(!(nan < 1_DF) && !(nan > 1_DF) && !(nan <= 1_DF) && !(nan >= 1_DF));
+}
+
+std::vector<decimal32> random_values(std::size_t n)
+{
+    std::mt19937_64 gen {42};
+    std::uniform_int_distribution<int> mantissa {BOOST_DECIMAL32_MAN_MIN, BOOST_DECIMAL32_MAN_MAX};
+    std::uniform_int_distribution<int> exponent {-3, 3};
+
+    const decimal32 specials[] = {std::numeric_limits<decimal32>::quiet_NaN(),
+                                  std::numeric_limits<decimal32>::signaling_NaN(),
+                                  std::numeric_limits<decimal32>::infinity(),
+                                  -std::numeric_limits<decimal32>::infinity(),
+                                  0_DF, -0_DF, 1.5_DF, -1.5_DF};
+
+    std::vector<decimal32> values;
+    for (std::size_t i {}; i < n; ++i)
+    {
+        if (gen() % 8 == 0)
+        {
+            values.push_back(specials[gen() % 8]);
+        }
+        else
+        {
+            values.emplace_back(static_cast<bool>(gen() % 2), mantissa(gen), exponent(gen));
+        }
+    }
+
+    return values;
+}
+
+// The dispatching functions only differ from the scalar reference when BOOST_DECIMAL_FILTER_AVX2
+// is defined, which the filter_avx2_test target in the Jamfile arranges with -mavx2
+void kernels_match_scalar()
+{
+    const decimal32 thresholds[] = {1.5_DF, -1.5_DF, 0_DF, 999_DF, std::numeric_limits<decimal32>::infinity(),
+                                    std::numeric_limits<decimal32>::quiet_NaN()};
+    const compare_op ops[] = {compare_op::less, compare_op::less_equal, compare_op::greater,
+                              compare_op::greater_equal, compare_op::equal, compare_op::not_equal};
+
+    for (const std::size_t n : {0U, 1U, 7U, 8U, 63U, 64U, 65U, 1000U})
+    {
+        const auto values {random_values(n)};
+        std::vector<std::uint64_t> fast(mask_words(n), ~UINT64_C(0));
+        std::vector<std::uint64_t> reference(mask_words(n));
+
+        for (const auto op : ops)
+        {
+            for (const auto t : thresholds)
+            {
+                BOOST_TEST_EQ(compare_mask(values, op, t, fast), detail::compare_mask_scalar(values, op, t, reference));
+                BOOST_TEST(fast == reference);
+            }
+        }
+
+        BOOST_TEST_EQ(between_mask(values, -1.5_DF, 999_DF, fast), detail::between_mask_scalar(values, -1.5_DF, 999_DF, reference));
+        BOOST_TEST(fast == reference);
+
+        BOOST_TEST_EQ(isnan_mask(values, fast), detail::isnan_mask_scalar(values, reference));
+        BOOST_TEST(fast == reference);
+
+        BOOST_TEST_EQ(signbit_mask(values, fast), detail::signbit_mask_scalar(values, reference));
+        BOOST_TEST(fast == reference);
+    }
+}
+
+void selection()
+{
+    const std::vector<decimal32> prices {10_DF, -2_DF, 7.5_DF, 12_DF, std::numeric_limits<decimal32>::quiet_NaN(),
+                                         7.49_DF, 8_DF, 0_DF, 11.99_DF};
+    std::vector<std::uint64_t> mask(mask_words(prices.size()));
+
+    BOOST_TEST_EQ(between_mask(prices, 7.5_DF, 12_DF, mask), 5U);
+    BOOST_TEST_EQ(mask[0], UINT64_C(0b101001101));
+
+    std::vector<std::uint32_t> indices(prices.size());
+    BOOST_TEST_EQ(mask_to_indices(mask, prices.size(), indices), 5U);
+    BOOST_TEST_EQ(indices[0], 0U);
+    BOOST_TEST_EQ(indices[1], 2U);
+    BOOST_TEST_EQ(indices[2], 3U);
+    BOOST_TEST_EQ(indices[3], 6U);
+    BOOST_TEST_EQ(indices[4], 8U);
+
+    BOOST_TEST_EQ(compare_mask(prices, compare_op::greater, 7.5_DF, mask), 4U);
+    BOOST_TEST_EQ(isnan_mask(prices, mask), 1U);
+    // numeric_limits<decimal32>::quiet_NaN() carries the sign bit
+    BOOST_TEST_EQ(signbit_mask(prices, mask), 2U);
+
+    std::vector<std::uint64_t> too_small {};
+    BOOST_TEST_THROWS(isnan_mask(prices, too_small), std::length_error);
+
+    std::vector<std::uint32_t> too_few(2);
+    BOOST_TEST_THROWS(mask_to_indices(std::vector<std::uint64_t> {0xFF}, 8, too_few), std::length_error);
+}
+
+int main()
+{
+    comparison_operators();
+    kernels_match_scalar();
+    selection();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,159 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/fixed_decimal.hpp"
+
+using boost::decimal::decimal32;
+using boost::decimal::fixed_decimal;
+
+using cents = fixed_decimal<2>;
+
+void construction()
+{
+    constexpr cents ten {10};
+    static_assert(ten.raw() == 1000);
+
+    constexpr cents price {cents::from_coefficient(12345, -3)};
+    static_assert(price.raw() == 1234);
+
+    BOOST_TEST_EQ(cents::from_coefficient(125, -3).raw(), 12);
+    BOOST_TEST_EQ(cents::from_coefficient(135, -3).raw(), 14);
+    BOOST_TEST_EQ(cents::from_coefficient(-135, -3).raw(), -14);
+    BOOST_TEST_EQ(cents::from_coefficient(0, 100).raw(), 0);
+
+    // from_coefficient scales by 10^expon, where decimal32 places the leading digit there
+    static_assert(cents::from_coefficient(1234, 1).raw() == 1234000);
+    static_assert(cents {decimal32 {1234, 1}}.raw() == 1234);
+
+    BOOST_TEST_THROWS(static_cast<void>(cents {(std::numeric_limits<std::int64_t>::max)()}), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(cents::from_coefficient(1, 40)), std::overflow_error);
+}
+
+void arithmetic()
+{
+    constexpr cents a {cents::from_raw(1050)};
+    constexpr cents b {cents::from_raw(-325)};
+
+    static_assert((a + b).raw() == 725);
+    static_assert((a - b).raw() == 1375);
+    static_assert((a * b).raw() == -3412);
+    static_assert((a / b).raw() == -323);
+
+    cents c {a};
+    c += b;
+    BOOST_TEST_EQ(c.raw(), 725);
+    c *= cents {2};
+    BOOST_TEST_EQ(c.raw(), 1450);
+    c /= cents {4};
+    BOOST_TEST_EQ(c.raw(), 362);
+    c -= a;
+    BOOST_TEST_EQ(c.raw(), -688);
+    BOOST_TEST_EQ((-c).raw(), 688);
+
+    BOOST_TEST(b < a);
+    BOOST_TEST(a == cents::from_raw(1050));
+    BOOST_TEST(a != b);
+
+    constexpr auto max_cents {cents::from_raw((std::numeric_limits<std::int64_t>::max)())};
+    constexpr auto min_cents {cents::from_raw((std::numeric_limits<std::int64_t>::min)())};
+    BOOST_TEST_THROWS(static_cast<void>(max_cents + cents::from_raw(1)), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(min_cents - cents::from_raw(1)), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(max_cents * cents {2}), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(-min_cents), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(a / cents {0}), std::domain_error);
+}
+
+void small_representation()
+{
+    using small = fixed_decimal<4, std::int32_t>;
+
+    constexpr small x {small::from_raw(15000)};
+    constexpr small y {small::from_raw(25000)};
+    static_assert((x * y).raw() == 37500);
+    static_assert((y / x).raw() == 16667);
+
+    BOOST_TEST_THROWS(static_cast<void>(small {1000000}), std::overflow_error);
+}
+
+// Intermediates beyond 64 bits, which take the portable path when built with BOOST_DECIMAL_DISABLE_INT128
+void wide_intermediates()
+{
+    using micros = fixed_decimal<6>;
+
+    constexpr micros x {micros::from_raw(3'000'000'000'000)};
+    constexpr micros y {micros::from_raw(2'000'000'000'001)};
+    static_assert((x * y).raw() == 6'000'000'000'003'000'000);
+    static_assert((x * y / y).raw() == x.raw());
+
+    // 5.5e-6 * 0.5 and 7.5e-6 * 0.5 are ties rounded to even
+    BOOST_TEST_EQ((micros::from_raw(11) * micros::from_raw(500'000)).raw(), 6);
+    BOOST_TEST_EQ((micros::from_raw(15) * micros::from_raw(500'000)).raw(), 8);
+    BOOST_TEST_EQ((micros::from_raw(-9'000'000'000'000'000'000) / micros::from_raw(3'000'000)).raw(),
+                  -3'000'000'000'000'000'000);
+
+    constexpr micros z {micros::from_raw(10'000'000'000'000)};
+    BOOST_TEST_THROWS(static_cast<void>(z * z), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(z / micros::from_raw(1)), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(micros::from_raw((std::numeric_limits<std::int64_t>::max)()) * micros::from_raw(1'000'001)),
+                      std::overflow_error);
+}
+
+void decimal32_interop()
+{
+    const decimal32 d {1234, 1};
+    const cents c {d};
+    BOOST_TEST_EQ(c.raw(), 1234);
+
+    const decimal32 round_trip {c.to_decimal32()};
+    BOOST_TEST_EQ(round_trip.mantissa(), d.mantissa());
+    BOOST_TEST_EQ(round_trip.exponent(), d.exponent());
+    BOOST_TEST_EQ(round_trip.sign(), d.sign());
+
+    const decimal32 neg {static_cast<decimal32>(cents::from_raw(-5))};
+    BOOST_TEST(neg.sign());
+    BOOST_TEST_EQ(neg.mantissa(), 5000000U);
+    BOOST_TEST_EQ(neg.exponent(), -2);
+    BOOST_TEST_EQ(cents {neg}.raw(), -5);
+
+    BOOST_TEST_EQ(cents::from_raw(0).to_decimal32().mantissa(), 0U);
+    BOOST_TEST_EQ(cents {decimal32 {}}.raw(), 0);
+
+    // More than 7 significant digits are rounded half to even
+    const decimal32 wide {cents::from_raw(123456785).to_decimal32()};
+    BOOST_TEST_EQ(wide.mantissa(), 1234568U);
+    BOOST_TEST_EQ(wide.exponent(), 6);
+
+    const decimal32 carry {cents::from_raw(999999995).to_decimal32()};
+    BOOST_TEST_EQ(carry.mantissa(), 1000000U);
+    BOOST_TEST_EQ(carry.exponent(), 7);
+
+    BOOST_TEST_THROWS(static_cast<void>(cents {std::numeric_limits<decimal32>::infinity()}), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(cents {decimal32(1, 30)}), std::overflow_error);
+}
+
+void string_conversion()
+{
+    BOOST_TEST_EQ(cents::from_raw(-1250).to_string(), std::string {"-12.50"});
+    BOOST_TEST_EQ(cents::from_raw(5).to_string(), std::string {"0.05"});
+    BOOST_TEST_EQ((fixed_decimal<0> {42}.to_string()), std::string {"42"});
+}
+
+int main()
+{
+    construction();
+    arithmetic();
+    small_representation();
+    wide_intermediates();
+    decimal32_interop();
+    string_conversion();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,78 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <limits>
+#include <stdexcept>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/literals.hpp"
+
+using namespace boost::decimal;
+
+template <typename T>
+consteval bool same_bits(T lhs, T rhs)
+{
+    return lhs.sign() == rhs.sign() && lhs.mantissa() == rhs.mantissa() && lhs.exponent() == rhs.exponent();
+}
+
+// Literals are always produced at compile time
+static_assert(same_bits(1.25_DF, decimal32 {false, 1250000, 0}));
+static_assert(same_bits(10_DF, decimal32 {10, 1}));
+static_assert(same_bits(0.0125_df, decimal32 {false, 1250000, -2}));
+static_assert(same_bits(1.5e3_DF, decimal32 {false, 1500000, 3}));
+static_assert(same_bits(150E-2_DF, decimal32 {false, 1500000, 0}));
+static_assert(same_bits(0.0_DF, decimal32 {}));
+static_assert(same_bits(9999999_DF, std::numeric_limits<decimal32>::max() * 1e-57_DF));
+
+// Rounded half to even to seven digits
+static_assert(same_bits(1.2345675_DF, decimal32 {false, 1234568, 0}));
+static_assert(same_bits(1.2345665_DF, decimal32 {false, 1234566, 0}));
+static_assert(same_bits(9.9999995_DF, decimal32 {false, 1000000, 1}));
+static_assert(same_bits(1.00000050000000000000001_DF, decimal32 {false, 1000001, 0}));
+
+// Digit separators are ignored wherever C++ allows them
+static_assert(same_bits(1'000.25_DF, decimal32 {false, 1000250, 3}));
+static_assert(same_bits(0.000'125_DF, decimal32 {false, 1250000, -4}));
+static_assert(same_bits(1e1'0_DF, decimal32 {false, 1000000, 10}));
+
+// Overflow of the exponent range saturates to infinity
+static_assert(same_bits(1e60_DF * 1e10_DF, std::numeric_limits<decimal32>::infinity()));
+
+// Construction, arithmetic and comparison are all usable in constant evaluation
+constexpr decimal32 tick_sizes[] = {0.01_DF, 0.05_DF, 0.1_DF, 0.25_DF};
+static_assert(same_bits(tick_sizes[1] * 2_DF, tick_sizes[2]));
+static_assert(tick_sizes[3] == 0.25_DF);
+static_assert(tick_sizes[3] != tick_sizes[2]);
+static_assert(same_bits(-tick_sizes[0], decimal32 {-1, -2}));
+static_assert(same_bits(+tick_sizes[0], tick_sizes[0]));
+static_assert(same_bits(-1.5_DF * -2_DF, 3_DF));
+static_assert(same_bits(1234567_DF * 1234567_DF, decimal32 {false, 1524156, 12}));
+static_assert(2.5_DF > 2.4_DF);
+static_assert((2.5_DF).to_double() == 2.5);
+static_assert((12.75_DF).to_int() == 12);
+static_assert(10_DF == 10);
+
+int main()
+{
+    const decimal32 runtime_value {1250, 0};
+    BOOST_TEST(runtime_value == 1.25_DF);
+
+    // Multiplication must not depend on operand order or mutate either side
+    decimal32 fee {0.3_DF};
+    fee *= 3_DF;
+    BOOST_TEST(fee == 0.9_DF);
+
+    const decimal32 neg {-fee};
+    BOOST_TEST(neg.sign());
+    BOOST_TEST(!fee.sign());
+
+    // Values outside the range of decimal32 are rejected by the parser, which makes the literal ill-formed
+    BOOST_TEST_THROWS(static_cast<void>(detail::parse_decimal32_literal("1e70")), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(detail::parse_decimal32_literal("1e-70")), std::underflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(detail::parse_decimal32_literal("1.5x")), std::invalid_argument);
+    BOOST_TEST(same_bits(detail::parse_decimal32_literal("0e-70"), decimal32 {}));
+
+    return boost::report_errors();
+}
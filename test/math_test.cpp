@@ -0,0 +1,100 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <limits>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/decimal.hpp"
+
+using namespace boost::decimal;
+
+constexpr bool same_bits(decimal32 lhs, decimal32 rhs)
+{
+    return lhs.sign() == rhs.sign() && lhs.mantissa() == rhs.mantissa() && lhs.exponent() == rhs.exponent();
+}
+
+// Every function is usable in constant evaluation
+static_assert(same_bits(sqrt(2_DF), 1.414214_DF));
+static_assert(same_bits(exp(1_DF), 2.718282_DF));
+static_assert(same_bits(log(10_DF), 2.302585_DF));
+static_assert(same_bits(pow(2_DF, 10_DF), 1024_DF));
+static_assert(same_bits(fma(3_DF, 4_DF, 5_DF), 17_DF));
+
+void test_sqrt()
+{
+    BOOST_TEST(same_bits(sqrt(100_DF), 10_DF));
+    BOOST_TEST(same_bits(sqrt(0.0001_DF), 0.01_DF));
+    BOOST_TEST(same_bits(sqrt(1.234567_DF), 1.111111_DF));
+    BOOST_TEST(same_bits(sqrt(9999999_DF), 3162.278_DF));
+    BOOST_TEST(same_bits(sqrt(1e-11_DF), 3.162278e-6_DF));
+
+    BOOST_TEST(same_bits(sqrt(0_DF), 0_DF));
+    BOOST_TEST(isnan(sqrt(-1_DF)));
+    BOOST_TEST(isinf(sqrt(std::numeric_limits<decimal32>::infinity())));
+}
+
+void test_exp()
+{
+    BOOST_TEST(same_bits(exp(0_DF), 1_DF));
+    BOOST_TEST(same_bits(exp(-3.5_DF), 0.03019738_DF));
+    BOOST_TEST(same_bits(exp(100_DF), 2.688117e43_DF));
+    BOOST_TEST(same_bits(exp(1e-10_DF), 1_DF));
+    BOOST_TEST(same_bits(exp(147_DF), 6.938871e63_DF));
+
+    BOOST_TEST(isinf(exp(148_DF)));
+    BOOST_TEST(same_bits(exp(-1000_DF), 0_DF));
+    BOOST_TEST(same_bits(exp(-std::numeric_limits<decimal32>::infinity()), 0_DF));
+}
+
+void test_log()
+{
+    BOOST_TEST(same_bits(log(1_DF), 0_DF));
+    BOOST_TEST(same_bits(log(0.5_DF), -0.6931472_DF));
+    BOOST_TEST(same_bits(log(0.0001_DF), -9.210340_DF));
+    BOOST_TEST(same_bits(log(9999999_DF), 16.11810_DF));
+    BOOST_TEST(same_bits(log(1.000001_DF), 9.999995e-7_DF));
+
+    BOOST_TEST(isinf(log(0_DF)) && log(0_DF).sign());
+    BOOST_TEST(isnan(log(-1_DF)));
+}
+
+void test_pow()
+{
+    BOOST_TEST(same_bits(pow(10_DF, -3_DF), 0.001_DF));
+    BOOST_TEST(same_bits(pow(1.1_DF, 2.5_DF), 1.269059_DF));
+    BOOST_TEST(same_bits(pow(-2_DF, 3_DF), -8_DF));
+    BOOST_TEST(same_bits(pow(-2_DF, 2_DF), 4_DF));
+    BOOST_TEST(same_bits(pow(0.5_DF, 0_DF), 1_DF));
+    BOOST_TEST(same_bits(pow(0_DF, 2_DF), 0_DF));
+
+    BOOST_TEST(isnan(pow(-2_DF, 0.5_DF)));
+    BOOST_TEST(isinf(pow(0_DF, -1_DF)));
+    BOOST_TEST(isinf(pow(10_DF, 64_DF)));
+    BOOST_TEST(same_bits(pow(10_DF, -100_DF), 0_DF));
+    BOOST_TEST(same_bits(pow(0.5_DF, std::numeric_limits<decimal32>::infinity()), 0_DF));
+}
+
+void test_fma()
+{
+    // The product 1.000002000001 is kept exact until the single final rounding
+    BOOST_TEST(same_bits(fma(1.000001_DF, 1.000001_DF, -1_DF), 2.000001e-6_DF));
+    BOOST_TEST(same_bits(fma(1e-30_DF, 1_DF, 1_DF), 1_DF));
+    BOOST_TEST(same_bits(fma(2_DF, 3_DF, -6_DF), 0_DF));
+    BOOST_TEST(same_bits(fma(0_DF, 3_DF, 1.5_DF), 1.5_DF));
+    BOOST_TEST(same_bits(fma(9999999_DF, 9999999_DF, -1e-20_DF), 9.999998e13_DF));
+
+    BOOST_TEST(isnan(fma(std::numeric_limits<decimal32>::infinity(), 0_DF, 1_DF)));
+}
+
+int main()
+{
+    test_sqrt();
+    test_exp();
+    test_log();
+    test_pow();
+    test_fma();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,159 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/quantile_sketch.hpp"
+#include "../include/boost/decimal/literals.hpp"
+
+using namespace boost::decimal;
+
+// Three leading digits over prices from 0.001 to 999999
+using price_sketch = quantile_sketch<3, -3, 5>;
+
+// Small enough to keep on a thread stack
+static_assert(sizeof(quantile_sketch<3>) <= 256 * 1024);
+static_assert(sizeof(quantile_sketch<4, 0, 0>) <= 256 * 1024);
+static_assert(sizeof(quantile_sketch<2, BOOST_DECIMAL32_EMIN, BOOST_DECIMAL32_EMAX>) <= 256 * 1024);
+
+constexpr bool same_bits(decimal32 lhs, decimal32 rhs)
+{
+    return lhs.sign() == rhs.sign() && lhs.mantissa() == rhs.mantissa() && lhs.exponent() == rhs.exponent();
+}
+
+// |estimate - exact| <= relative_accuracy * |exact|
+bool within_accuracy(decimal32 estimate, decimal32 exact)
+{
+    const decimal32 tolerance {price_sketch::relative_accuracy() * (exact.sign() ? -exact : exact)};
+    return fma(-1_DF, tolerance, exact) <= estimate && estimate <= fma(1_DF, tolerance, exact);
+}
+
+void basic()
+{
+    price_sketch sketch {};
+
+    BOOST_TEST(same_bits(price_sketch::relative_accuracy(), 0.005_DF));
+    BOOST_TEST(isnan(sketch.quantile(0.5_DF)));
+    BOOST_TEST(isnan(sketch.min()));
+
+    for (const auto x : {1.5_DF, -2_DF, 0_DF, 10.25_DF, 7_DF})
+    {
+        sketch.insert(x);
+    }
+    sketch.insert(std::numeric_limits<decimal32>::quiet_NaN());
+
+    BOOST_TEST_EQ(sketch.count(), 5U);
+    BOOST_TEST_EQ(sketch.nan_count(), 1U);
+    BOOST_TEST(same_bits(sketch.min(), -2_DF));
+    BOOST_TEST(same_bits(sketch.max(), 10.25_DF));
+
+    // Extremes are exact and the middle ranks fall in the right buckets
+    BOOST_TEST(same_bits(sketch.quantile(0_DF), -2_DF));
+    BOOST_TEST(same_bits(sketch.quantile(1_DF), 10.25_DF));
+    BOOST_TEST(same_bits(sketch.quantile(0.4_DF), 0_DF));
+    BOOST_TEST(same_bits(sketch.quantile(0.6_DF), 1.505_DF));
+    BOOST_TEST(same_bits(sketch.quantile(0.8_DF), 7.005_DF));
+
+    BOOST_TEST(isnan(sketch.quantile(1.5_DF)));
+    BOOST_TEST(isnan(sketch.quantile(-0.5_DF)));
+
+    sketch.insert(std::numeric_limits<decimal32>::infinity());
+    BOOST_TEST(isinf(sketch.quantile(1_DF)));
+
+    sketch.clear();
+    BOOST_TEST_EQ(sketch.count(), 0U);
+    BOOST_TEST_EQ(sketch.nan_count(), 0U);
+}
+
+void accuracy_and_merge()
+{
+    std::mt19937_64 gen {42};
+    std::uniform_int_distribution<int> mantissa {BOOST_DECIMAL32_MAN_MIN, BOOST_DECIMAL32_MAN_MAX};
+    std::uniform_int_distribution<int> exponent {-3, 5};
+
+    price_sketch whole {};
+    price_sketch first_half {};
+    price_sketch second_half {};
+
+    std::vector<decimal32> values;
+    for (int i {}; i < 20000; ++i)
+    {
+        values.emplace_back(gen() % 4 == 0, mantissa(gen), exponent(gen));
+    }
+
+    whole.insert(values);
+    first_half.insert(std::span<const decimal32>(values).first(values.size() / 2));
+    second_half.insert(std::span<const decimal32>(values).subspan(values.size() / 2));
+    first_half += second_half;
+
+    std::sort(values.begin(), values.end());
+
+    // Quantiles in thousandths so the exact rank ceil(q * n) is an integer computation
+    for (const std::size_t per_mille : {1U, 10U, 250U, 500U, 900U, 990U, 999U})
+    {
+        const decimal32 q {detail::make_decimal32(false, per_mille, -3)};
+        const std::size_t rank {(per_mille * values.size() + 999) / 1000};
+        const decimal32 exact {values[rank - 1]};
+
+        BOOST_TEST(within_accuracy(whole.quantile(q), exact));
+        BOOST_TEST(same_bits(whole.quantile(q), first_half.quantile(q)));
+    }
+
+    BOOST_TEST_EQ(first_half.count(), whole.count());
+    BOOST_TEST(same_bits(first_half.min(), values.front()));
+    BOOST_TEST(same_bits(first_half.max(), values.back()));
+}
+
+void out_of_range()
+{
+    quantile_sketch<2> sketch {};
+    quantile_sketch<2> tiny {};
+
+    // Only 1 lies inside the default exponent range [-8, 8]
+    for (const auto x : {1_DF, 1e12_DF, 3e15_DF, 7e20_DF})
+    {
+        sketch.insert(x);
+    }
+
+    BOOST_TEST_EQ(sketch.out_of_range_count(), 3U);
+    BOOST_TEST(same_bits(sketch.quantile(0.25_DF), 1.05_DF));
+    BOOST_TEST(same_bits(sketch.quantile(0.5_DF), 7e20_DF));
+    BOOST_TEST(same_bits(sketch.quantile(0.75_DF), 7e20_DF));
+    BOOST_TEST(same_bits(sketch.quantile(1_DF), 7e20_DF));
+
+    // Values below the range order around zero and report the range boundary
+    for (const auto x : {-3e-12_DF, -2e15_DF, 0_DF, 5e-20_DF, 4e-9_DF})
+    {
+        tiny.insert(x);
+    }
+
+    BOOST_TEST(same_bits(tiny.quantile(0.2_DF), -2e15_DF));
+    BOOST_TEST(same_bits(tiny.quantile(0.4_DF), -1e-8_DF));
+    BOOST_TEST(same_bits(tiny.quantile(0.6_DF), 0_DF));
+    BOOST_TEST(same_bits(tiny.quantile(0.8_DF), 4e-9_DF));
+    BOOST_TEST(same_bits(tiny.quantile(1_DF), 4e-9_DF));
+
+    sketch += tiny;
+    BOOST_TEST_EQ(sketch.out_of_range_count(), 7U);
+    BOOST_TEST(same_bits(sketch.quantile(0_DF), -2e15_DF));
+    BOOST_TEST(same_bits(sketch.quantile(1_DF), 7e20_DF));
+
+    sketch.clear();
+    BOOST_TEST_EQ(sketch.out_of_range_count(), 0U);
+}
+
+int main()
+{
+    basic();
+    accuracy_and_merge();
+    out_of_range();
+
+    return boost::report_errors();
+}
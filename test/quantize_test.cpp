@@ -0,0 +1,135 @@
+//  Copyright (c) 2022 Matt Borland
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/core/lightweight_test.hpp>
+
+#include "../include/boost/decimal/quantize.hpp"
+#include "../include/boost/decimal/literals.hpp"
+
+using namespace boost::decimal;
+
+constexpr bool same_bits(decimal32 lhs, decimal32 rhs)
+{
+    return lhs.sign() == rhs.sign() && lhs.mantissa() == rhs.mantissa() && lhs.exponent() == rhs.exponent();
+}
+
+static_assert(same_bits(quantize(1.2345_DF, 0.01_DF), 1.23_DF));
+static_assert(same_bits(rescale(1.2355_DF, -3), 1.236_DF));
+static_assert(same_bits(round_to_increment(1.13_DF, 0.05_DF), 1.15_DF));
+
+void test_rescale()
+{
+    BOOST_TEST(same_bits(rescale(1.2345_DF, -2), 1.23_DF));
+    BOOST_TEST(same_bits(rescale(1.2345_DF, 0), 1_DF));
+    BOOST_TEST(same_bits(rescale(1234.5_DF, 2), 1200_DF));
+    BOOST_TEST(same_bits(rescale(9.9996_DF, -3), 10_DF));
+    BOOST_TEST(same_bits(rescale(0.4_DF, 0), 0_DF));
+    BOOST_TEST(same_bits(rescale(0.0004_DF, 5), 0_DF));
+    BOOST_TEST(same_bits(rescale(1.5_DF, -6), 1.5_DF));
+
+    // Ties under each rounding mode
+    BOOST_TEST(same_bits(rescale(2.5_DF, 0, rounding_mode::fe_dec_to_nearest), 2_DF));
+    BOOST_TEST(same_bits(rescale(3.5_DF, 0, rounding_mode::fe_dec_to_nearest), 4_DF));
+    BOOST_TEST(same_bits(rescale(2.5_DF, 0, rounding_mode::fe_dec_to_nearest_from_zero), 3_DF));
+    BOOST_TEST(same_bits(rescale(-2.5_DF, 0, rounding_mode::fe_dec_to_nearest_from_zero), -3_DF));
+    BOOST_TEST(same_bits(rescale(2.9_DF, 0, rounding_mode::fe_dec_toward_zero), 2_DF));
+    BOOST_TEST(same_bits(rescale(-2.1_DF, 0, rounding_mode::fe_dec_upward), -2_DF));
+    BOOST_TEST(same_bits(rescale(2.1_DF, 0, rounding_mode::fe_dec_upward), 3_DF));
+    BOOST_TEST(same_bits(rescale(-2.1_DF, 0, rounding_mode::fe_dec_downward), -3_DF));
+    BOOST_TEST(same_bits(rescale(0.001_DF, 0, rounding_mode::fe_dec_upward), 1_DF));
+
+    BOOST_TEST(isnan(rescale(std::numeric_limits<decimal32>::infinity(), 0)));
+    BOOST_TEST(isnan(rescale(std::numeric_limits<decimal32>::quiet_NaN(), 0)));
+}
+
+void test_quantize()
+{
+    BOOST_TEST(same_bits(quantize(1.2355_DF, 1.001_DF), 1.236_DF));
+    BOOST_TEST(same_bits(quantize(-7.777_DF, 0.25_DF), -7.78_DF));
+    BOOST_TEST(same_bits(quantize(123.456_DF, 100_DF), 100_DF));
+    BOOST_TEST(same_bits(quantize(123.456_DF, 0_DF), 123_DF));
+
+    // A result that rounds to zero keeps the sign of the operand
+    BOOST_TEST(same_bits(quantize(-0.004_DF, 0.01_DF), -0_DF));
+    BOOST_TEST((-0_DF).sign());
+    BOOST_TEST(same_bits(rescale(-0.4_DF, 0), -0_DF));
+    BOOST_TEST(same_bits(rescale(-0.0004_DF, 5), -0_DF));
+    BOOST_TEST(same_bits(rescale(-0_DF, -2), -0_DF));
+
+    BOOST_TEST(samequantum(0.05_DF, 1.25_DF));
+    BOOST_TEST(samequantum(300_DF, 100_DF));
+    BOOST_TEST(!samequantum(100_DF, 1_DF));
+    BOOST_TEST(!samequantum(0.5_DF, 0.25_DF));
+    BOOST_TEST(samequantum(std::numeric_limits<decimal32>::infinity(), -std::numeric_limits<decimal32>::infinity()));
+    BOOST_TEST(!samequantum(std::numeric_limits<decimal32>::quiet_NaN(), 1_DF));
+
+    BOOST_TEST(isinf(quantize(std::numeric_limits<decimal32>::infinity(), std::numeric_limits<decimal32>::infinity())));
+    BOOST_TEST(isnan(quantize(1_DF, std::numeric_limits<decimal32>::infinity())));
+}
+
+void test_round_to_increment()
+{
+    BOOST_TEST(same_bits(round_to_increment(1.12_DF, 0.05_DF), 1.1_DF));
+    BOOST_TEST(same_bits(round_to_increment(1.125_DF, 0.05_DF), 1.1_DF));
+    BOOST_TEST(same_bits(round_to_increment(1.125_DF, 0.05_DF, rounding_mode::fe_dec_to_nearest_from_zero), 1.15_DF));
+    BOOST_TEST(same_bits(round_to_increment(-1.13_DF, 0.25_DF), -1.25_DF));
+    BOOST_TEST(same_bits(round_to_increment(1.13_DF, -0.25_DF), 1.25_DF));
+    BOOST_TEST(same_bits(round_to_increment(1.13_DF, 0.25_DF, rounding_mode::fe_dec_downward), 1_DF));
+    BOOST_TEST(same_bits(round_to_increment(7_DF, 5_DF, rounding_mode::fe_dec_upward), 10_DF));
+    BOOST_TEST(same_bits(round_to_increment(0.01_DF, 5_DF), 0_DF));
+    BOOST_TEST(same_bits(round_to_increment(1234567_DF, 0.003_DF), 1234567_DF));
+
+    // x / tick is far wider than 64 bits here
+    BOOST_TEST(same_bits(round_to_increment(1e20_DF, 3e-10_DF), 1e20_DF));
+    BOOST_TEST(same_bits(round_to_increment(1.000001e7_DF, 0.3_DF), 10000010_DF));
+
+    // Rounding to zero keeps the sign of x
+    BOOST_TEST(same_bits(round_to_increment(-0.01_DF, 5_DF), -0_DF));
+    BOOST_TEST(same_bits(round_to_increment(-2_DF, 5_DF), -0_DF));
+    BOOST_TEST(same_bits(round_to_increment(-7_DF, 5_DF, rounding_mode::fe_dec_upward), -5_DF));
+    BOOST_TEST(same_bits(round_to_increment(-3_DF, 5_DF, rounding_mode::fe_dec_upward), -0_DF));
+
+    BOOST_TEST(isnan(round_to_increment(1_DF, 0_DF)));
+    BOOST_TEST(isnan(round_to_increment(1_DF, std::numeric_limits<decimal32>::infinity())));
+}
+
+void test_batch()
+{
+    const std::vector<decimal32> prices {1.12_DF, 1.125_DF, -1.13_DF, std::numeric_limits<decimal32>::quiet_NaN()};
+    std::vector<decimal32> snapped(prices.size());
+
+    round_to_increment(prices, 0.05_DF, snapped);
+    for (std::size_t i {}; i < prices.size(); ++i)
+    {
+        BOOST_TEST(same_bits(snapped[i], round_to_increment(prices[i], 0.05_DF)));
+    }
+
+    quantize(prices, 0.1_DF, snapped, rounding_mode::fe_dec_toward_zero);
+    for (std::size_t i {}; i < prices.size(); ++i)
+    {
+        BOOST_TEST(same_bits(snapped[i], quantize(prices[i], 0.1_DF, rounding_mode::fe_dec_toward_zero)));
+    }
+
+    // In place
+    std::vector<decimal32> in_place {prices};
+    rescale(in_place, -1, in_place);
+    BOOST_TEST(same_bits(in_place[2], -1.1_DF));
+
+    std::vector<decimal32> too_small(1);
+    BOOST_TEST_THROWS(rescale(prices, 0, too_small), std::length_error);
+}
+
+int main()
+{
+    test_rescale();
+    test_quantize();
+    test_round_to_increment();
+    test_batch();
+
+    return boost::report_errors();
+}
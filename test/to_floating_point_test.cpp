@@ -4,7 +4,9 @@
 //  LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <concepts>
+#include <cstdlib>
 #include <stdexcept>
+#include <string>
 #include <boost/core/lightweight_test.hpp>
 
 #include "../include/boost/decimal/decimal32.hpp"
@@ -19,11 +21,39 @@ void to_type()
     BOOST_TEST(neg_ten.to<T>() == static_cast<T>(-10));
 }
 
+// Conversions are correctly rounded across the whole exponent range
+void exponent_extremes()
+{
+    using boost::decimal::decimal32;
+
+    BOOST_TEST_EQ((decimal32 {false, 1234567, -20}.to_double()), 1.234567e-20);
+    BOOST_TEST_EQ((decimal32 {false, 1000000, -63}.to_double()), 1e-63);
+    BOOST_TEST_EQ((decimal32 {false, 9999999, 63}.to_double()), 9.999999e63);
+    BOOST_TEST_EQ((decimal32 {true, 9999999, 63}.to_double()), -9.999999e63);
+
+    BOOST_TEST_EQ((decimal32 {false, 1000000, -33}.to_float()), 1e-33F);
+    BOOST_TEST_EQ((decimal32 {false, 1175494, -38}.to_float()), 1.175494e-38F);
+    BOOST_TEST_EQ((decimal32 {false, 1234567, -45}.to_float()), 1.234567e-45F);
+    BOOST_TEST_EQ((decimal32 {false, 3402823, 38}.to_float()), 3.402823e38F);
+    BOOST_TEST_EQ((decimal32 {false, 1000000, -63}.to_float()), 0.0F);
+
+    // strtod is correctly rounded, so every scale must agree with it
+    for (int expon {-63}; expon <= 63; ++expon)
+    {
+        for (const int mantissa : {1000000, 1234567, 4999999, 9999999})
+        {
+            const std::string str {std::to_string(mantissa) + "e" + std::to_string(expon - 6)};
+            BOOST_TEST_EQ((decimal32 {false, mantissa, expon}.to_double()), std::strtod(str.c_str(), nullptr));
+        }
+    }
+}
+
 int main()
 {
     to_type<float>();
     to_type<double>();
     to_type<long double>();
+    exponent_extremes();
 
     boost::decimal::decimal32_t huge(10, 60);
     BOOST_TEST_THROWS(huge.to_float(), std::overflow_error);